@@ -22,6 +22,7 @@
 #include "SAMRAI/hier/Variable.h"
 #include "SAMRAI/hier/VariableContext.h"
 #include "SAMRAI/mesh/GriddingAlgorithm.h"
+#include "SAMRAI/mesh/PatchWorkloadRecorder.h"
 #include "SAMRAI/mesh/StandardTagAndInitStrategy.h"
 #include "SAMRAI/tbox/Database.h"
 #include "SAMRAI/tbox/Serializable.h"
@@ -749,6 +750,26 @@ public:
    printStatistics(
       std::ostream& s = tbox::plog) const;
 
+   /**
+    * Set a recorder to time the flux computation and conservative
+    * difference on each patch during advanceLevel().  The measured
+    * cost is kept in the recorder's workload data, which a load
+    * balancer can use for the next regrid.  The workload of a
+    * regridded level is copied to its replacement in
+    * initializeLevelData(), and workload data is allocated on every
+    * level passed to resetHierarchyConfiguration().  A null pointer
+    * turns timing off.
+    *
+    * Advances done for error estimation, and advances of levels not in
+    * the hierarchy, are not timed.
+    */
+   void
+   setPatchWorkloadRecorder(
+      const std::shared_ptr<mesh::PatchWorkloadRecorder>& recorder)
+   {
+      d_workload_recorder = recorder;
+   }
+
    /**
     * Returns the object name.
     */
@@ -1122,6 +1143,11 @@ private:
     */
    bool d_barrier_advance_level_sections;
 
+   /*
+    * Optional recorder of measured per-patch cost.
+    */
+   std::shared_ptr<mesh::PatchWorkloadRecorder> d_workload_recorder;
+
    /*
     * Timers interspersed throughout the class.
     */
@@ -18,6 +18,7 @@
 #include "SAMRAI/hier/ComponentSelector.h"
 #include "SAMRAI/tbox/Database.h"
 #include "SAMRAI/mesh/GriddingAlgorithm.h"
+#include "SAMRAI/mesh/PatchWorkloadRecorder.h"
 #include "SAMRAI/algs/MethodOfLinesPatchStrategy.h"
 #include "SAMRAI/hier/PatchHierarchy.h"
 #include "SAMRAI/hier/PatchLevel.h"
@@ -344,6 +345,23 @@ public:
       return d_object_name;
    }
 
+   /*!
+    * Set a recorder to time the singleStep() calls on each patch during
+    * advanceHierarchy().  The time of all Runge-Kutta stages is summed
+    * per patch.  The measured cost is kept in the recorder's workload
+    * data, which a load balancer can use for the next regrid.  The
+    * workload of a regridded level is copied to its replacement in
+    * initializeLevelData(), and workload data is allocated on every
+    * level passed to resetHierarchyConfiguration().  A null pointer
+    * turns timing off.
+    */
+   void
+   setPatchWorkloadRecorder(
+      const std::shared_ptr<mesh::PatchWorkloadRecorder>& recorder)
+   {
+      d_workload_recorder = recorder;
+   }
+
 private:
    /*
     * Static integer constant describing class's version number.
@@ -470,6 +488,11 @@ private:
    hier::ComponentSelector d_scratch_data;
    hier::ComponentSelector d_rhs_data;
 
+   /*
+    * Optional recorder of measured per-patch cost.
+    */
+   std::shared_ptr<mesh::PatchWorkloadRecorder> d_workload_recorder;
+
 };
 
 }
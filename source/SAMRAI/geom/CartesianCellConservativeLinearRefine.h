@@ -16,6 +16,7 @@
 #include "SAMRAI/pdat/InvokeOne.h"
 #include "SAMRAI/hier/RefineOperator.h"
 #include "SAMRAI/hier/Box.h"
+#include "SAMRAI/hier/BoxContainer.h"
 #include "SAMRAI/hier/IntVector.h"
 #include "SAMRAI/hier/Patch.h"
 
@@ -308,6 +309,22 @@ public:
       const hier::Box& fine_box,
       const hier::IntVector& ratio) const;
 
+private:
+   /*
+    * Refine all of the fine boxes with one call to the C++ kernels in
+    * CartesianCellTransferKernels, which share slope scratch between the
+    * boxes and may thread over them.  The dcomplex specialization has no
+    * C++ kernel and refines the boxes one at a time.
+    */
+   void
+   refineBoxes(
+      hier::Patch& fine,
+      const hier::Patch& coarse,
+      const int dst_component,
+      const int src_component,
+      const hier::BoxContainer& fine_boxes,
+      const hier::IntVector& ratio) const;
+
 };
 
 }
@@ -16,6 +16,7 @@
 
 #include "SAMRAI/hier/RefineOperator.h"
 #include "SAMRAI/hier/Box.h"
+#include "SAMRAI/hier/BoxContainer.h"
 #include "SAMRAI/hier/IntVector.h"
 #include "SAMRAI/hier/Patch.h"
 
@@ -110,6 +111,20 @@ public:
       const hier::Box& fine_box,
       const hier::IntVector& ratio) const;
 
+private:
+   /*
+    * Refine all of the fine boxes with one call to the C++ kernels in
+    * CartesianCellTransferKernels.
+    */
+   void
+   refineBoxes(
+      hier::Patch& fine,
+      const hier::Patch& coarse,
+      const int dst_component,
+      const int src_component,
+      const hier::BoxContainer& fine_boxes,
+      const hier::IntVector& ratio) const;
+
 };
 
 }
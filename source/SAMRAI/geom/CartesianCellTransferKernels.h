@@ -0,0 +1,143 @@
+/*************************************************************************
+ *
+ * This file is part of the SAMRAI distribution.  For full copyright
+ * information, see COPYRIGHT and LICENSE.
+ *
+ * Copyright:     (c) 1997-2020 Lawrence Livermore National Security, LLC
+ * Description:   C++ kernels for refining and coarsening cell-centered
+ *                data on a Cartesian mesh.
+ *
+ ************************************************************************/
+
+#ifndef included_geom_CartesianCellTransferKernels
+#define included_geom_CartesianCellTransferKernels
+
+#include "SAMRAI/SAMRAI_config.h"
+
+#include "SAMRAI/hier/Box.h"
+#include "SAMRAI/hier/BoxContainer.h"
+#include "SAMRAI/hier/IntVector.h"
+#include "SAMRAI/pdat/ArrayData.h"
+
+#include <vector>
+
+namespace SAMRAI {
+namespace geom {
+
+/**
+ * Class CartesianCellTransferKernels<TYPE> holds the numerical kernels
+ * for conservative linear refinement and volume weighted averaging of
+ * cell-centered real data on a Cartesian mesh, in 1, 2 and 3 dimensions.
+ *
+ * The kernels compute the same values as the FORTRAN routines
+ * cartclinrefcell*() and cartwgtavgcell*(), to within rounding, but
+ * work on all depth components of the arrays at once and take a whole
+ * set of boxes per call.  Refinement of a set of boxes reuses one scratch array for the
+ * limited slopes per thread and, when built with OpenMP, spreads the
+ * boxes over threads.  This matters on fine levels where one overlap
+ * holds many small boxes and the per-call overhead would otherwise
+ * dominate the arithmetic.
+ *
+ * TYPE must be double or float.
+ *
+ * @see CartesianCellConservativeLinearRefine
+ * @see CartesianCellDoubleWeightedAverage
+ */
+
+template<class TYPE>
+class CartesianCellTransferKernels
+{
+public:
+   /**
+    * Conservatively interpolate coarse data to the fine data on each of
+    * the fine boxes, using the MUSCL limited slopes of the coarse data.
+    *
+    * @param fine    Fine array data to fill.
+    * @param coarse  Coarse array data to interpolate from.
+    * @param fine_boxes  Boxes, in the fine index space, to fill.
+    * @param ratio   Refinement ratio between the coarse and fine data.
+    * @param cdx     Coarse mesh spacing.
+    * @param fdx     Fine mesh spacing.
+    *
+    * @pre fine.getDim() == coarse.getDim()
+    * @pre fine.getDim().getValue() <= 3
+    * @pre fine.getDepth() == coarse.getDepth()
+    * Boxes that intersect are refined one after another, in order, so
+    * threads are only used when the boxes are pairwise disjoint.
+    *
+    * @pre each fine box lies in fine.getBox() and its coarsened box,
+    *      grown by one cell, lies in coarse.getBox()
+    */
+   static void
+   conservativeLinearRefine(
+      pdat::ArrayData<TYPE>& fine,
+      const pdat::ArrayData<TYPE>& coarse,
+      const hier::BoxContainer& fine_boxes,
+      const hier::IntVector& ratio,
+      const double* cdx,
+      const double* fdx);
+
+   /**
+    * Set the coarse data on the coarse box to the volume weighted
+    * average of the fine data.
+    *
+    * @param coarse  Coarse array data to fill.
+    * @param fine    Fine array data to average.
+    * @param coarse_box  Box, in the coarse index space, to fill.
+    * @param ratio   Refinement ratio between the coarse and fine data.
+    * @param fdx     Fine mesh spacing.
+    * @param cdx     Coarse mesh spacing.
+    *
+    * @pre fine.getDim() == coarse.getDim()
+    * @pre fine.getDim().getValue() <= 3
+    * @pre fine.getDepth() == coarse.getDepth()
+    * @pre coarse_box lies in coarse.getBox() and its refined box lies
+    *      in fine.getBox()
+    */
+   static void
+   weightedAverage(
+      pdat::ArrayData<TYPE>& coarse,
+      const pdat::ArrayData<TYPE>& fine,
+      const hier::Box& coarse_box,
+      const hier::IntVector& ratio,
+      const double* fdx,
+      const double* cdx);
+
+private:
+   // The following are not implemented:
+   CartesianCellTransferKernels();
+   ~CartesianCellTransferKernels();
+   CartesianCellTransferKernels(
+      const CartesianCellTransferKernels&);
+   CartesianCellTransferKernels&
+   operator = (
+      const CartesianCellTransferKernels&);
+
+   /*
+    * Refine one fine box.  scratch holds the slopes and is grown as
+    * needed, so one vector serves any number of boxes.
+    */
+   static void
+   conservativeLinearRefineBox(
+      pdat::ArrayData<TYPE>& fine,
+      const pdat::ArrayData<TYPE>& coarse,
+      const hier::Box& fine_box,
+      const hier::IntVector& ratio,
+      const double* cdx,
+      const double* fdx,
+      std::vector<TYPE>& scratch);
+
+   /*
+    * Fewest cells in a batch of boxes (or in one box being averaged)
+    * for which the kernels use more than one thread.
+    */
+   static const size_t s_min_parallel_cells = 4096;
+
+};
+
+}
+}
+
+#include "SAMRAI/geom/CartesianCellTransferKernels.C"
+
+#endif
@@ -24,6 +24,7 @@
 #include "SAMRAI/tbox/MessageStream.h"
 #include "SAMRAI/tbox/Utilities.h"
 
+#include <atomic>
 #include <iostream>
 
 namespace SAMRAI {
@@ -1379,14 +1380,16 @@ public:
 #ifdef BOX_TELEMETRY
    // These are to optionally track the cumulative number of Boxes constructed,
    // the cumulative number of Box assignments, and the high water mark of
-   // Boxes in existance at any given time.
-   static int s_cumulative_constructed_ct;
+   // Boxes in existance at any given time.  The counts are atomic because
+   // Boxes are made on several threads at once, but the high water mark may
+   // miss a peak reached while two threads update it.
+   static std::atomic<int> s_cumulative_constructed_ct;
 
-   static int s_cumulative_assigned_ct;
+   static std::atomic<int> s_cumulative_assigned_ct;
 
-   static int s_active_ct;
+   static std::atomic<int> s_active_ct;
 
-   static int s_high_water;
+   static std::atomic<int> s_high_water;
 #endif
 
 private:
@@ -1478,10 +1481,13 @@ private:
  * \endverbatim
  * Note that the box iterator may not compile to efficient code, depending
  * on your compiler.  Many compilers are not smart enough to optimize the
- * looping constructs and indexing operations.
+ * looping constructs and indexing operations.  When the loop can be
+ * written as a loop body, for_each_index() in ForEachIndex.h runs it as
+ * nested loops of the box's dimension instead.
  *
  * @see Index
  * @see Box
+ * @see for_each_index
  */
 
 class BoxIterator : public std::iterator<std::random_access_iterator_tag, Index>
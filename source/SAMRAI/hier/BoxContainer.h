@@ -1926,6 +1926,26 @@ private:
       return d_tree.get() != 0;
    }
 
+   /*!
+    * @brief Return an estimate of the number of bytes allocated to hold
+    * the Boxes, including the ordering of an ordered container but not
+    * the search tree.
+    */
+   size_t
+   getMemoryFootprint() const
+   {
+      // List nodes carry two links; set nodes carry three links and a color.
+      return d_list.size() * (sizeof(Box) + 2 * sizeof(void *))
+             + d_set.size() * (sizeof(Box *) + 4 * sizeof(void *));
+   }
+
+   /*!
+    * @brief Return the number of bytes allocated by the search tree, or
+    * zero if there is no search tree.
+    */
+   size_t
+   getTreeMemoryFootprint() const;
+
    /*!
     * @brief Query if this BoxContainer contains any Box with the given
     * BlockId.
@@ -2023,6 +2043,34 @@ private:
       const IntVector& refinement_ratio,
       bool include_singularity_block_neighbors = false) const;
 
+   /*!
+    * @brief Find all boxes that intersect with each of the given boxes.
+    *
+    * Batched version of findOverlapBoxes with refinement ratio.  Every
+    * Box in this BoxContainer that intersects with boxes[i] will be
+    * added to overlap_boxes[i], which retains its ordered/unordered
+    * state.  The queries are searched in groups that walk the search
+    * tree together, which is faster than searching them one at a time
+    * when there are many of them.
+    *
+    * @param[in,out]  overlap_boxes
+    *
+    * @param[in]  boxes
+    *
+    * @param[in]  refinement_ratio
+    *
+    * @param[in]  include_singularity_block_neighbors
+    *
+    * @pre hasTree()
+    * @pre overlap_boxes.size() == boxes.size()
+    */
+   void
+   findOverlapBoxes(
+      std::vector<BoxContainer>& overlap_boxes,
+      const std::vector<Box>& boxes,
+      const IntVector& refinement_ratio,
+      bool include_singularity_block_neighbors = false) const;
+
    /*!
     * @brief Determine if a given box intersects with the BoxContainer.
     *
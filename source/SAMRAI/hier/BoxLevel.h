@@ -373,6 +373,46 @@ public:
    const BoxLevel&
    getGlobalizedVersion() const;
 
+   /*!
+    * @brief Set whether BoxLevels may acquire remote Boxes.
+    *
+    * Globalizing gathers every Box to every process, which takes
+    * memory and communication proportional to the number of processes.
+    * Forbidding it turns every globalization into an error, to find
+    * code paths that do not scale.  Algorithms with a distributed
+    * alternative, such as OverlapConnectorAlgorithm::findOverlaps(),
+    * use the alternative while globalization is forbidden.
+    *
+    * Creating a BoxLevel in GLOBALIZED state from Boxes every process
+    * already has, such as the domain, is not affected.
+    *
+    * The default is from the input database, "allow_globalization" in
+    * the "BoxLevel" database, or true if not given.  Calling this method
+    * overrides the input.
+    *
+    * @param[in] allow
+    */
+   static void
+   setAllowGlobalization(
+      bool allow)
+   {
+      s_allow_globalization = allow ? 'y' : 'n';
+   }
+
+   /*!
+    * @brief Return whether BoxLevels may acquire remote Boxes.
+    *
+    * @see setAllowGlobalization()
+    */
+   static bool
+   getAllowGlobalization()
+   {
+      if (s_allow_globalization == '\0') {
+         getFromInput();
+      }
+      return s_allow_globalization == 'y';
+   }
+
    /*!
     * @brief Deallocate the internal globalized version of the
     * BoxLevel, if there is any.
@@ -1612,6 +1652,37 @@ public:
 
    //@{
 
+   /*!
+    * @name Memory accounting
+    */
+
+   /*!
+    * @brief Return an estimate of the number of bytes allocated to hold
+    * the local and global Boxes, including those of a cached globalized
+    * version.  Search trees are not included.
+    */
+   size_t
+   getBoxMemoryFootprint() const;
+
+   /*!
+    * @brief Return the number of bytes allocated by the search trees of
+    * the local and global Boxes, including those of a cached globalized
+    * version.
+    */
+   size_t
+   getSearchTreeMemoryFootprint() const;
+
+   /*!
+    * @brief Return an estimate of the number of bytes allocated by the
+    * persistent overlap Connectors incident from this BoxLevel.
+    */
+   size_t
+   getPersistentConnectorMemoryFootprint() const;
+
+   //@}
+
+   //@{
+
    /*!
     * @name Methods for outputs, error checking and debugging.
     */
@@ -1865,6 +1936,12 @@ private:
       tbox::Database& restart_db,
       const std::shared_ptr<const BaseGridGeometry>& grid_geom);
 
+   /*!
+    * @brief Read s_allow_globalization from the input database.
+    */
+   static void
+   getFromInput();
+
    /*!
     * @brief Set up things for the entire class.
     *
@@ -1892,6 +1969,7 @@ private:
       t_initialize_private.reset();
       t_acquire_remote_boxes.reset();
       t_cache_global_reduced_data.reset();
+      s_allow_globalization = '\0';
    }
 
    /*!
@@ -2070,6 +2148,12 @@ private:
     */
    static const LocalId s_negative_one_local_id;
 
+   /*!
+    * @brief Whether remote Boxes may be acquired, 'y' or 'n', or '\0'
+    * if not yet read from input.
+    */
+   static char s_allow_globalization;
+
    static tbox::StartupShutdownManager::Handler
       s_initialize_finalize_handler;
 
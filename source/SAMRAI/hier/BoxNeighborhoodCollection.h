@@ -21,6 +21,7 @@
 #include "SAMRAI/tbox/Dimension.h"
 #include "SAMRAI/tbox/Utilities.h"
 
+#include <algorithm>
 #include <map>
 #include <set>
 #include <vector>
@@ -129,6 +130,51 @@ private:
     */
    HeadBoxLinkCt d_nbr_link_ct;
 
+   /*!
+    * @brief True if the neighborhoods are held in the frozen (compressed
+    * sparse row) representation below instead of in the pools above.
+    */
+   bool d_frozen;
+
+   /*!
+    * @brief Frozen representation: the BoxIds of the base Boxes in
+    * increasing order.
+    */
+   std::vector<BoxId> d_frozen_base_boxes;
+
+   /*!
+    * @brief Frozen representation: the neighborhood of
+    * d_frozen_base_boxes[i] is given by the entries of d_frozen_links in
+    * [d_frozen_offsets[i], d_frozen_offsets[i+1]).
+    */
+   std::vector<int> d_frozen_offsets;
+
+   /*!
+    * @brief Frozen representation: indices into d_frozen_nbrs of the
+    * neighbors of each base Box, in increasing BoxId order within each
+    * neighborhood.
+    */
+   std::vector<int> d_frozen_links;
+
+   /*!
+    * @brief Frozen representation: the distinct head Boxes, in increasing
+    * BoxId order.
+    */
+   std::vector<Box> d_frozen_nbrs;
+
+   /*!
+    * @brief Abort if the object is frozen.  Called on entry to every
+    * method that may modify the neighborhoods.
+    */
+   void
+   checkEditable() const
+   {
+      if (d_frozen) {
+         TBOX_ERROR("BoxNeighborhoodCollection: attempt to modify a frozen\n"
+            << "collection.  Call thaw() first." << std::endl);
+      }
+   }
+
 public:
    // Constructors.
 
@@ -252,6 +298,7 @@ public:
          d_collection = rhs.d_collection;
          d_itr = rhs.d_itr;
          d_base_boxes_itr = rhs.d_base_boxes_itr;
+         d_frozen_idx = rhs.d_frozen_idx;
          return *this;
       }
 
@@ -267,6 +314,7 @@ public:
          d_collection = rhs.d_collection;
          d_itr = rhs.d_itr;
          d_base_boxes_itr = rhs.d_base_boxes_itr;
+         d_frozen_idx = 0;
          return *this;
       }
 
@@ -286,6 +334,9 @@ public:
       const BoxId&
       operator * () const
       {
+         if (d_collection->d_frozen) {
+            return d_collection->d_frozen_base_boxes[d_frozen_idx];
+         }
          return *(d_itr->first);
       }
 
@@ -296,6 +347,9 @@ public:
       const BoxId *
       operator -> () const
       {
+         if (d_collection->d_frozen) {
+            return &d_collection->d_frozen_base_boxes[d_frozen_idx];
+         }
          return d_itr->first;
       }
 
@@ -307,12 +361,8 @@ public:
       operator ++ (
          int)
       {
-         // Go to the next base Box.
          ConstIterator tmp = *this;
-         if (d_base_boxes_itr != d_collection->d_base_boxes.end()) {
-            ++d_base_boxes_itr;
-            ++d_itr;
-         }
+         ++(*this);
          return tmp;
       }
 
@@ -324,7 +374,12 @@ public:
       operator ++ ()
       {
          // Go to the next base Box.
-         if (d_base_boxes_itr != d_collection->d_base_boxes.end()) {
+         if (d_collection->d_frozen) {
+            if (d_frozen_idx <
+                static_cast<int>(d_collection->d_frozen_base_boxes.size())) {
+               ++d_frozen_idx;
+            }
+         } else if (d_base_boxes_itr != d_collection->d_base_boxes.end()) {
             ++d_base_boxes_itr;
             ++d_itr;
          }
@@ -340,8 +395,13 @@ public:
       operator == (
          const ConstIterator& rhs) const
       {
-         return d_collection == rhs.d_collection &&
-                d_itr == rhs.d_itr &&
+         if (d_collection != rhs.d_collection) {
+            return false;
+         }
+         if (d_collection->d_frozen) {
+            return d_frozen_idx == rhs.d_frozen_idx;
+         }
+         return d_itr == rhs.d_itr &&
                 d_base_boxes_itr == rhs.d_base_boxes_itr;
       }
 
@@ -373,11 +433,28 @@ private:
          const BoxNeighborhoodCollection& nbrhds,
          AdjListConstItr itr);
 
+      /*!
+       * @brief Constructs an iterator pointing to the base Box at position
+       * frozen_idx of a frozen nbrhds.  Should only be called by
+       * BoxNeighborhoodCollection.
+       *
+       * @param nbrhds
+       *
+       * @param frozen_idx
+       */
+      ConstIterator(
+         const BoxNeighborhoodCollection& nbrhds,
+         int frozen_idx);
+
       const BoxNeighborhoodCollection* d_collection;
 
+      // Used when d_collection is not frozen.
       AdjListConstItr d_itr;
 
       BaseBoxPoolItr d_base_boxes_itr;
+
+      // Used when d_collection is frozen.
+      int d_frozen_idx;
    };
 
    class NeighborIterator;
@@ -601,6 +678,8 @@ public:
          d_collection = rhs.d_collection;
          d_base_box = rhs.d_base_box;
          d_itr = rhs.d_itr;
+         d_frozen_pos = rhs.d_frozen_pos;
+         d_frozen_end = rhs.d_frozen_end;
          return *this;
       }
 
@@ -616,6 +695,8 @@ public:
          d_collection = rhs.d_collection;
          d_base_box = rhs.d_base_box;
          d_itr = rhs.d_itr;
+         d_frozen_pos = 0;
+         d_frozen_end = 0;
          return *this;
       }
 
@@ -635,6 +716,10 @@ public:
       const Box&
       operator * () const
       {
+         if (d_collection->d_frozen) {
+            return d_collection->d_frozen_nbrs[
+                      d_collection->d_frozen_links[d_frozen_pos]];
+         }
          return *(*d_itr);
       }
 
@@ -645,6 +730,10 @@ public:
       const Box *
       operator -> () const
       {
+         if (d_collection->d_frozen) {
+            return &d_collection->d_frozen_nbrs[
+                      d_collection->d_frozen_links[d_frozen_pos]];
+         }
          return *d_itr;
       }
 
@@ -657,9 +746,7 @@ public:
          int)
       {
          ConstNeighborIterator tmp = *this;
-         if (d_itr != d_collection->d_adj_list.find(d_base_box)->second.end()) {
-            ++d_itr;
-         }
+         ++(*this);
          return tmp;
       }
 
@@ -670,7 +757,12 @@ public:
       ConstNeighborIterator&
       operator ++ ()
       {
-         if (d_itr != d_collection->d_adj_list.find(d_base_box)->second.end()) {
+         if (d_collection->d_frozen) {
+            if (d_frozen_pos < d_frozen_end) {
+               ++d_frozen_pos;
+            }
+         } else if (d_itr !=
+                    d_collection->d_adj_list.find(d_base_box)->second.end()) {
             ++d_itr;
          }
          return *this;
@@ -685,9 +777,14 @@ public:
       operator == (
          const ConstNeighborIterator& rhs) const
       {
-         return d_collection == rhs.d_collection &&
-                d_base_box == rhs.d_base_box &&
-                d_itr == rhs.d_itr;
+         if (d_collection != rhs.d_collection ||
+             d_base_box != rhs.d_base_box) {
+            return false;
+         }
+         if (d_collection->d_frozen) {
+            return d_frozen_pos == rhs.d_frozen_pos;
+         }
+         return d_itr == rhs.d_itr;
       }
 
       /*!
@@ -710,7 +807,14 @@ private:
 
       const BoxId* d_base_box;
 
+      // Used when d_collection is not frozen.
       NeighborhoodConstItr d_itr;
+
+      // Used when d_collection is frozen: the current and one past the
+      // last position in d_collection->d_frozen_links.
+      int d_frozen_pos;
+
+      int d_frozen_end;
    };
 
    /*!
@@ -860,6 +964,8 @@ private:
    /*!
     * @brief Returns an iterator pointing to the beginning of the collection
     * of neighborhoods.
+    *
+    * @pre !isFrozen()
     */
    Iterator
    begin()
@@ -880,6 +986,8 @@ private:
    /*!
     * @brief Returns an iterator pointing just past the end of the
     * collection of neighborhoods.
+    *
+    * @pre !isFrozen()
     */
    Iterator
    end()
@@ -1041,6 +1149,17 @@ private:
    find(
       const BoxId& base_box_id) const
    {
+      if (d_frozen) {
+         std::vector<BoxId>::const_iterator itr =
+            std::lower_bound(d_frozen_base_boxes.begin(),
+               d_frozen_base_boxes.end(),
+               base_box_id);
+         if (itr == d_frozen_base_boxes.end() || *itr != base_box_id) {
+            return end();
+         }
+         return ConstIterator(*this,
+            static_cast<int>(itr - d_frozen_base_boxes.begin()));
+      }
       BaseBoxPoolItr base_boxes_itr = d_base_boxes.find(base_box_id);
       if (base_boxes_itr == d_base_boxes.end()) {
          return end();
@@ -1055,11 +1174,14 @@ private:
     * end().
     *
     * @param base_box_id
+    *
+    * @pre !isFrozen()
     */
    Iterator
    find(
       const BoxId& base_box_id)
    {
+      checkEditable();
       BaseBoxPoolItr base_boxes_itr = d_base_boxes.find(base_box_id);
       if (base_boxes_itr == d_base_boxes.end()) {
          return end();
@@ -1084,7 +1206,7 @@ private:
    bool
    empty() const
    {
-      return d_base_boxes.empty();
+      return d_frozen ? d_frozen_base_boxes.empty() : d_base_boxes.empty();
    }
 
    /*!
@@ -1093,7 +1215,8 @@ private:
    int
    numBoxNeighborhoods() const
    {
-      return static_cast<int>(d_base_boxes.size());
+      return static_cast<int>(d_frozen ? d_frozen_base_boxes.size() :
+                              d_base_boxes.size());
    }
 
    /*!
@@ -1124,6 +1247,10 @@ private:
    {
       TBOX_ASSERT(base_box_itr.d_collection == this);
       TBOX_ASSERT(base_box_itr != end());
+      if (d_frozen) {
+         return d_frozen_offsets[base_box_itr.d_frozen_idx] ==
+                d_frozen_offsets[base_box_itr.d_frozen_idx + 1];
+      }
       return base_box_itr.d_itr->second.empty();
    }
 
@@ -1155,6 +1282,10 @@ private:
    {
       TBOX_ASSERT(base_box_itr.d_collection == this);
       TBOX_ASSERT(base_box_itr != end());
+      if (d_frozen) {
+         return d_frozen_offsets[base_box_itr.d_frozen_idx + 1]
+                - d_frozen_offsets[base_box_itr.d_frozen_idx];
+      }
       return static_cast<int>(base_box_itr.d_itr->second.size());
    }
 
@@ -1235,6 +1366,58 @@ private:
 
    //@}
 
+   //@{
+   /*!
+    * @name Frozen representation
+    *
+    * A frozen collection holds its neighborhoods in compressed sparse row
+    * form: the sorted base Box ids, an offset array into a packed array of
+    * neighbor indices, and one copy of each distinct head Box.  This costs
+    * a few bytes per relationship instead of the several tree nodes used
+    * by the editable representation, and is intended for neighborhoods
+    * which are no longer being edited, such as those of cached overlap
+    * Connectors.
+    *
+    * A frozen object is read-only: only const methods, clear() and
+    * assignment work on it, besides coarsenNeighbors, refineNeighbors and
+    * growNeighbors, which change the frozen boxes in place.  Any other
+    * method that may modify the neighborhoods, including the non-const
+    * begin(), end() and find(), is an error until thaw() is called.
+    * Freezing or thawing invalidates all iterators.
+    */
+
+   /*!
+    * @brief Convert to the compact, frozen representation.  This is a
+    * no-op if the object is already frozen.
+    */
+   void
+   freeze();
+
+   /*!
+    * @brief Convert back to the editable representation.  This is a no-op
+    * if the object is not frozen.
+    */
+   void
+   thaw();
+
+   /*!
+    * @brief Returns true if the object is in the frozen representation.
+    */
+   bool
+   isFrozen() const
+   {
+      return d_frozen;
+   }
+
+   /*!
+    * @brief Return an estimate of the number of bytes allocated to hold
+    * the neighborhoods in the current representation.
+    */
+   size_t
+   getMemoryFootprint() const;
+
+   //@}
+
    /*!
     * @brief Insert the rank of the processor owning each neighbor in each
     * neighborhood into the supplied set.
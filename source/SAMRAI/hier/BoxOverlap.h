@@ -18,6 +18,8 @@
 namespace SAMRAI {
 namespace hier {
 
+class BoxContainer;
+
 /*!
  * @brief Class BoxOverlap is an abstract base class used to represent a region
  * where data will be communicated between two AMR patches.
@@ -90,6 +92,27 @@ public:
    virtual const Transformation&
    getTransformation() const = 0;
 
+   /*!
+    * @brief Append to boxes a set of boxes that contains the destination
+    * index region of the overlap.
+    *
+    * The boxes are in the destination index space of the overlap's data
+    * type.  Subclasses that hold several index spaces, such as those of
+    * edge, face or side data, append the boxes of all of them, so boxes
+    * of overlaps of the same type may be tested for intersection to rule
+    * out that both write the same data.
+    *
+    * The default implementation appends nothing and returns false,
+    * meaning that the region is unknown.
+    *
+    * @param[in,out] boxes
+    *
+    * @return Whether the boxes contain the destination region.
+    */
+   virtual bool
+   getBoundingBoxes(
+      BoxContainer& boxes) const;
+
    /*!
     * @brief Print BoxOverlap object data.
     *
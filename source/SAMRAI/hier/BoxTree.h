@@ -4,7 +4,7 @@
  * information, see COPYRIGHT and LICENSE.
  *
  * Copyright:     (c) 1997-2020 Lawrence Livermore National Security, LLC
- * Description:   Binary tree of Boxes for overlap searches.
+ * Description:   Bounding volume hierarchy of Boxes for overlap searches.
  *
  ************************************************************************/
 
@@ -17,7 +17,6 @@
 #include "SAMRAI/tbox/Timer.h"
 
 #include <vector>
-#include <list>
 #include <memory>
 
 namespace SAMRAI {
@@ -26,13 +25,21 @@ namespace hier {
 class BoxContainer;
 
 /*!
- * @brief Utility sorting Boxes into tree-like form for finding
- * box overlaps.
+ * @brief Utility sorting Boxes into a bounding volume hierarchy for
+ * finding box overlaps.
  *
- * This class recursively splits a set of Boxes into tree-like
- * form and stores them for fast searches.  The recursive
- * splitting stops when the number of boxes in a leaf node of the tree
- * is less than a minimum number specified in the constructor.
+ * The tree is bulk-built from a set of Boxes by recursively splitting
+ * them at the median of their centers along the direction in which
+ * the centers are most spread out.  The splitting stops when the
+ * number of boxes in a leaf is no more than a minimum number specified
+ * in the constructor.
+ *
+ * The tree is stored flat: its nodes are kept in one array in
+ * depth-first order, each holding its bounding box and the index of
+ * the first node past its subtree, so searches walk the array without
+ * recursion or pointer chasing.  The boxes are reordered to leaf order
+ * and their bounds are copied into a contiguous array so leaf checks
+ * do not dereference the Boxes.
  *
  * All boxes in a BoxTree must exist in the same index space.
  * This means that they must all have the same BlockId value.
@@ -41,6 +48,10 @@ class BoxContainer;
  * - hasOverlap()
  * - findOverlapBoxes()
  *
+ * findOverlapBoxes() also has a batched version taking many query
+ * boxes at once.  It walks the tree once for each group of queries,
+ * carrying along only the queries intersecting the current node.
+ *
  * Except for two static methods and a destructor needed by shared_ptr,
  * the entire interface is private.
  */
@@ -78,8 +89,23 @@ public:
 
 private:
 
+   /*!
+    * @brief Constructs a BoxTree from pointers to Boxes.
+    *
+    * @param[in] dim
+    *
+    * @param[in] boxes The Boxes must outlive the tree.
+    *
+    * @param[in] min_number Split up sets of boxes while the number of
+    * boxes in a subset is greater than this value.  @b Default: 10
+    *
+    * @pre !boxes.empty()
+    * @pre for each box in boxes, !box->empty()
+    * @pre each box in boxes has a valid, identical BlockId
+    */
    BoxTree(
-      const std::list<const Box *> boxes,
+      const tbox::Dimension& dim,
+      const std::vector<const Box *>& boxes,
       int min_number = 10);
 
    /*!
@@ -102,48 +128,18 @@ private:
       const BoxContainer& boxes,
       int min_number = 10);
 
-   /*!
-    * @brief Constructor building an uninitialized object.
-    *
-    * Private as it is used only internally to create child trees.
-    * The object can be initialized using generateTree().
-    *
-    * @param[in] dim
-    */
-   explicit BoxTree(
-      const tbox::Dimension& dim);
-
    /*!
     * Default constructor is unimplemented and should not be used.
     */
    BoxTree();
 
    /*!
-    * @brief Reset to uninitialized state.
-    *
-    * The dimension of boxes in the tree cannot be changed.
-    *
-    * Uninitialized trees can be initialized using generateTree().
-    */
-   void
-   clear()
-   {
-      d_bounding_box.setEmpty();
-      d_left_child.reset();
-      d_right_child.reset();
-      d_boxes.clear();
-      d_center_child.reset();
-   }
-
-   /*!
-    * @brief Check whether the tree has been initialized.
-    *
-    * Uninitialized trees can be initialized using generateTree().
+    * @brief Check whether the tree has any Boxes.
     */
    bool
    isInitialized() const
    {
-      return !d_bounding_box.empty();
+      return !d_nodes.empty();
    }
 
    //@{
@@ -165,6 +161,18 @@ private:
       return d_block_id;
    }
 
+   /*!
+    * @brief Return the number of bytes allocated by the tree, not
+    * counting the Boxes it refers to.
+    */
+   size_t
+   getMemoryFootprint() const
+   {
+      return d_nodes.capacity() * sizeof(Node)
+             + d_boxes.capacity() * sizeof(const Box *)
+             + d_box_bounds.capacity() * sizeof(int);
+   }
+
    //@}
 
    //@{
@@ -198,17 +206,13 @@ private:
     *
     * @param[in] box the specified box whose overlaps are requested.
     *
-    * @param[in] recursive_call Disable logging of information except at first
-    * call.
-    *
     * @pre getDim() == box.getDim()
     * @pre box.getBlockId() == getBlockId()
     */
    void
    findOverlapBoxes(
       std::vector<const Box *>& overlap_boxes,
-      const Box& box,
-      bool recursive_call = false) const;
+      const Box& box) const;
 
    /*!
     * @brief Find all boxes that overlap the given \b box.
@@ -222,56 +226,117 @@ private:
     *
     * @param[in] box the specified box whose overlaps are requested.
     *
-    * @param[in] recursive_call Disable logging of information except at first
-    * call.
-    *
     * @pre getDim() == box.getDim()
     * @pre box.getBlockId() == getBlockId()
     */
    void
    findOverlapBoxes(
       BoxContainer& overlap_boxes,
-      const Box& box,
-      bool recursive_call = false) const;
-
-   //@}
+      const Box& box) const;
 
    /*!
-    * @brief Private recursive function for generating the search tree.
+    * @brief Find all boxes that overlap each of the given \b boxes.
     *
-    * d_boxes is changed in the process (for efficiency reasons).
-    * On output it will contain any boxes that are not assigned to a child
-    * tree.
+    * Boxes overlapping boxes[i] are added to overlap_boxes[i].  The
+    * output containers are not emptied and keep their ordered/unordered
+    * state.  Groups of queries are searched on multiple threads when
+    * OpenMP is enabled.
     *
-    * The object is not cleared in this method.  If the object has
-    * been initialized, it should be cleared before calling this
-    * method.  @see clear().
+    * @param[in,out] overlap_boxes
+    *
+    * @param[in] boxes
     *
-    * @param min_number  @b Default: 10
+    * @pre overlap_boxes.size() == boxes.size()
+    * @pre for each box in boxes, box.getBlockId() == getBlockId()
     */
    void
-   privateGenerateTree(
-      int min_number = 10);
+   findOverlapBoxes(
+      std::vector<BoxContainer>& overlap_boxes,
+      const std::vector<Box>& boxes) const;
+
+   //@}
 
    /*!
-    * @brief Set up the child branches.
+    * @brief A node of the flattened tree.
     *
-    * This method is called after splitting the Boxes into the
-    * left_boxes and right_boxes, with boxes straddling
-    * the divider stored in d_boxes.  It generates
-    * d_left_child, d_right_child and, if needed, d_center_child.
+    * Children of an interior node at index i are at i+1 and at the
+    * d_skip index of node i+1.
+    */
+   struct Node {
+      //! @brief Bounding box of the node's Boxes.
+      int d_lower[SAMRAI::MAX_DIM_VAL];
+      int d_upper[SAMRAI::MAX_DIM_VAL];
+      //! @brief First position in d_boxes belonging to the node.
+      int d_begin;
+      //! @brief Number of Boxes held by a leaf, 0 for interior nodes.
+      int d_count;
+      //! @brief Index of the first node past this node's subtree.
+      int d_skip;
+   };
+
+   /*!
+    * @brief Sort the Boxes in d_boxes into the tree.
     *
     * @param[in] min_number
+    */
+   void
+   privateBuild(
+      int min_number);
+
+   /*!
+    * @brief Build the subtree for d_boxes[begin,end) and append its
+    * nodes to d_nodes.
     *
-    * @param[in,out] left_boxes
-    *
-    * @param[in,out] right_boxes
+    * d_boxes[begin,end) is reordered in the process.
     */
    void
-   setupChildren(
-      const int min_number,
-      std::list<const Box*>& left_boxes,
-      std::list<const Box*>& right_boxes);
+   privateGenerateTree(
+      int begin,
+      int end,
+      int min_number);
+
+   /*!
+    * @brief Find the positions in d_boxes of Boxes intersecting the
+    * query bounds.
+    */
+   void
+   privateFindOverlaps(
+      std::vector<int>& found,
+      const int* query_lower,
+      const int* query_upper) const;
+
+   /*!
+    * @brief Search for one group of queries, starting at node
+    * node_index and carrying the query indices in
+    * active[active_begin, active.size()).
+    *
+    * @return Index of the first node past node_index's subtree.
+    */
+   int
+   privateFindOverlapsForGroup(
+      std::vector<std::vector<int> >& found,
+      int node_index,
+      std::vector<int>& active,
+      size_t active_begin,
+      const std::vector<int>& query_bounds) const;
+
+   /*!
+    * @brief Whether box bounds intersect.
+    */
+   bool
+   intersects(
+      const int* lower_a,
+      const int* upper_a,
+      const int* lower_b,
+      const int* upper_b) const
+   {
+      for (int d = 0; d < d_dim.getValue(); ++d) {
+         if (lower_a[d] > upper_b[d] || lower_b[d] > upper_a[d]) {
+            return false;
+         }
+      }
+      return true;
+   }
 
    /*!
     * @brief Set up static class members.
@@ -295,40 +360,32 @@ private:
     */
    const tbox::Dimension d_dim;
 
-   /*!
-    * @brief Bounding box of all the Boxes in this tree.
-    */
-   Box d_bounding_box;
-
    /*!
     * @brief BlockId
     */
    BlockId d_block_id;
 
    /*!
-    * std::shared_ptrs to familial boxes.
+    * @brief Tree nodes in depth-first order.  The root is d_nodes[0].
     */
-   std::shared_ptr<BoxTree> d_left_child;
-   std::shared_ptr<BoxTree> d_right_child;
+   std::vector<Node> d_nodes;
 
    /*!
-    * @brief A tree for Boxes that are not given to the left or
-    * right children.
+    * @brief The Boxes, ordered so that each leaf's Boxes are
+    * contiguous.
     */
-   std::shared_ptr<BoxTree> d_center_child;
+   std::vector<const Box *> d_boxes;
 
    /*!
-    * @brief Boxes that are contained within the physical domain
-    * that this tree represents.  When we have a small number of boxes
-    * that do not warant the overhead of a child tree, the boxes go here.
+    * @brief Lower and upper corners of d_boxes, 2*dim ints per Box.
     */
-   std::list<const Box*> d_boxes;
+   std::vector<int> d_box_bounds;
 
    /*!
-    * @brief Dimension along which the input box triples are
-    * partitioned.
+    * @brief Number of queries searched together by the batched
+    * findOverlapBoxes().
     */
-   tbox::Dimension::dir_t d_partition_dir;
+   static const int s_batch_size = 16;
 
    /*
     * Timers are static to keep the objects light-weight.
@@ -112,6 +112,9 @@ public:
    /*!
     * @brief Copy constructor.
     *
+    * The copy holds its relationships in the editable representation
+    * even if other's are frozen.
+    *
     * @param[in] other
     */
    Connector(
@@ -662,6 +665,56 @@ public:
       d_global_data_up_to_date = false;
    }
 
+   /*!
+    * @brief Switch the relationships to the compact, read-only
+    * representation of BoxNeighborhoodCollection.
+    *
+    * Intended for Connectors that are no longer being built up, such as
+    * cached overlap Connectors.  A frozen Connector is read-only: methods
+    * that may modify its relationships, including the non-const
+    * iterator accessors, are errors until thawNeighborhoods() is called.
+    * Freezing invalidates all iterators into this Connector.
+    */
+   void
+   freezeNeighborhoods()
+   {
+      d_relationships.freeze();
+      d_global_relationships.freeze();
+   }
+
+   /*!
+    * @brief Switch the relationships back to the editable representation.
+    *
+    * Thawing invalidates all iterators into this Connector.
+    */
+   void
+   thawNeighborhoods()
+   {
+      d_relationships.thaw();
+      d_global_relationships.thaw();
+   }
+
+   /*!
+    * @brief Return an estimate of the number of bytes allocated to hold
+    * the local and, if any, globalized relationships.
+    */
+   size_t
+   getMemoryFootprint() const
+   {
+      return d_relationships.getMemoryFootprint()
+             + d_global_relationships.getMemoryFootprint();
+   }
+
+   /*!
+    * @brief Returns true if the local relationships are in the compact,
+    * read-only representation.
+    */
+   bool
+   neighborhoodsAreFrozen() const
+   {
+      return d_relationships.isFrozen();
+   }
+
    /*!
     * @brief Returns true is the neighborhood of the supplied BoxId is empty.
     *
@@ -870,6 +923,9 @@ public:
 
    /*!
     * @brief Assignment operator
+    *
+    * Like the copy constructor, this leaves the relationships in the
+    * editable representation.
     */
    Connector&
    operator = (
@@ -1141,15 +1197,30 @@ public:
    /*!
     * @brief Returns the transpose of this Connector if it exists.
     *
+    * The transpose of a const Connector, such as a cached overlap
+    * Connector, is read-only.
+    *
     * @pre hasTranspose()
     */
-   Connector&
+   const Connector&
    getTranspose() const
    {
       TBOX_ASSERT(hasTranspose());
       return *d_transpose;
    }
 
+   /*!
+    * @brief Returns the transpose of this Connector if it exists.
+    *
+    * @pre hasTranspose()
+    */
+   Connector&
+   getTranspose()
+   {
+      TBOX_ASSERT(hasTranspose());
+      return *d_transpose;
+   }
+
    /*!
     * @brief Sets this Connector's transpose and, if the transpose exists,
     * sets its transpose to this Connector.  If owns_transpose is true then
@@ -0,0 +1,367 @@
+/*************************************************************************
+ *
+ * This file is part of the SAMRAI distribution.  For full copyright
+ * information, see COPYRIGHT and LICENSE.
+ *
+ * Copyright:     (c) 1997-2020 Lawrence Livermore National Security, LLC
+ * Description:   Contiguous BoxId-ordered container of Boxes.
+ *
+ ************************************************************************/
+
+#ifndef included_hier_FlatBoxContainer
+#define included_hier_FlatBoxContainer
+
+#include "SAMRAI/SAMRAI_config.h"
+#include "SAMRAI/hier/Box.h"
+#include "SAMRAI/hier/BoxContainer.h"
+
+#include <iostream>
+#include <vector>
+
+namespace SAMRAI {
+namespace hier {
+
+/*!
+ * @brief A contiguous, BoxId-ordered container of Boxes.
+ *
+ * FlatBoxContainer holds the same kind of content as an ordered
+ * BoxContainer: Boxes with valid and unique BoxIds, iterated in BoxId
+ * order.  Instead of one heap node per Box in a list plus a set of
+ * pointers for the ordering, the Boxes are stored by value in a single
+ * sorted array.  This removes the per-Box allocations, roughly halves
+ * the memory per Box and turns iteration and BoxId searches into
+ * sequential and binary-search accesses of contiguous memory.
+ *
+ * The trade-off is that inserting or erasing a Box that does not belong
+ * at the end of the ordering costs O(N), and that any insertion or
+ * erasure invalidates iterators and pointers to members.  The container
+ * is therefore intended for large sets of Boxes that are built once
+ * (preferably in BoxId order, or in bulk with the range insert) and then
+ * iterated and searched many times, such as the boxes of a finalized
+ * BoxLevel.  It provides no domain calculus; convert to a BoxContainer
+ * with getBoxes() for that.
+ *
+ * Iteration uses the same const_iterator/begin()/end() idiom as
+ * BoxContainer, and the ordered BoxContainer query methods find(),
+ * lowerBound() and upperBound() have the same meaning.
+ *
+ * @see BoxContainer
+ */
+class FlatBoxContainer
+{
+public:
+   typedef std::vector<Box>::const_iterator const_iterator;
+
+   /*!
+    * @brief Default constructor creates an empty container.
+    */
+   FlatBoxContainer();
+
+   /*!
+    * @brief Construct from the Boxes of a BoxContainer.
+    *
+    * The BoxContainer may be ordered or unordered, but all of its Boxes
+    * must have valid and unique BoxIds.
+    *
+    * @param[in] boxes
+    *
+    * @pre each box in boxes has a valid and unique BoxId
+    */
+   explicit FlatBoxContainer(
+      const BoxContainer& boxes);
+
+   /*!
+    * @brief Copy constructor.
+    */
+   FlatBoxContainer(
+      const FlatBoxContainer& other);
+
+   /*!
+    * @brief Assignment operator.
+    */
+   FlatBoxContainer&
+   operator = (
+      const FlatBoxContainer& rhs);
+
+   /*!
+    * @brief The destructor releases all storage.
+    */
+   ~FlatBoxContainer();
+
+   /*!
+    * @brief Return the number of boxes in the container.
+    */
+   int
+   size() const
+   {
+      return static_cast<int>(d_boxes.size());
+   }
+
+   /*!
+    * @brief Returns true if there are no boxes in the container.
+    */
+   bool
+   empty() const
+   {
+      return d_boxes.empty();
+   }
+
+   /*!
+    * @brief Return a const_iterator pointing to the first box.
+    */
+   const_iterator
+   begin() const
+   {
+      return d_boxes.begin();
+   }
+
+   /*!
+    * @brief Return a const_iterator pointing beyond the last box.
+    */
+   const_iterator
+   end() const
+   {
+      return d_boxes.end();
+   }
+
+   /*!
+    * @brief Returns the box with the smallest BoxId.
+    *
+    * @pre !empty()
+    */
+   const Box&
+   front() const
+   {
+      TBOX_ASSERT(!empty());
+      return d_boxes.front();
+   }
+
+   /*!
+    * @brief Returns the box with the largest BoxId.
+    *
+    * @pre !empty()
+    */
+   const Box&
+   back() const
+   {
+      TBOX_ASSERT(!empty());
+      return d_boxes.back();
+   }
+
+   /*!
+    * @brief Reserve storage for the given number of boxes.
+    *
+    * Reserving the final size before a sequence of insertions avoids
+    * repeated reallocation of the underlying array.
+    *
+    * @param[in] num_boxes
+    */
+   void
+   reserve(
+      int num_boxes)
+   {
+      d_boxes.reserve(num_boxes);
+   }
+
+   /*!
+    * @brief Removes all the members of the container.
+    */
+   void
+   clear()
+   {
+      d_boxes.clear();
+   }
+
+   /*!
+    * @brief Swap all contents with another FlatBoxContainer.
+    *
+    * @param[in,out] other
+    */
+   void
+   swap(
+      FlatBoxContainer& other)
+   {
+      d_boxes.swap(other.d_boxes);
+   }
+
+   /*!
+    * @brief Insert a single Box.
+    *
+    * The Box is added unless the container already has a Box with the
+    * same BoxId.  Insertion is amortized O(1) when the Box belongs at the
+    * end of the ordering and O(N) otherwise.
+    *
+    * @return True if the Box was added, false if a Box with the same
+    * BoxId was already in the container.
+    *
+    * @param[in] box
+    *
+    * @pre box.getBoxId().isValid()
+    * @pre empty() || (front().getDim() == box.getDim())
+    */
+   bool
+   insert(
+      const Box& box);
+
+   /*!
+    * @brief Insert all Boxes in the range [first, last) of a BoxContainer.
+    *
+    * Boxes having the BoxId of a Box already in this container (or of
+    * an earlier Box in the range) are not added.  The range is appended
+    * and then merged into the ordering, costing O(N log N) for the whole
+    * range rather than O(N) per Box.
+    *
+    * @param[in] first
+    * @param[in] last
+    *
+    * @pre for each box in [first, last), box.getBoxId().isValid()
+    */
+   void
+   insert(
+      BoxContainer::const_iterator first,
+      BoxContainer::const_iterator last);
+
+   /*!
+    * @brief Erase the Box having the same BoxId as the argument.
+    *
+    * @return 1 if a Box is erased, 0 otherwise.
+    *
+    * @param[in] box Box serving as key.  Only its BoxId is used.
+    */
+   int
+   erase(
+      const Box& box);
+
+   /*!
+    * @brief Erase the Box pointed to by iter.
+    *
+    * @param[in] iter
+    *
+    * @pre iter points to a member of this container
+    */
+   void
+   erase(
+      const_iterator iter);
+
+   /*!
+    * @brief Find the Box having the same BoxId as the argument.
+    *
+    * @return Iterator to the Box if found, otherwise end().
+    *
+    * @param[in] box Box serving as key.  Only its BoxId is used.
+    */
+   const_iterator
+   find(
+      const Box& box) const
+   {
+      return find(box.getBoxId());
+   }
+
+   /*!
+    * @brief Find the Box having the given BoxId.
+    *
+    * @return Iterator to the Box if found, otherwise end().
+    *
+    * @param[in] box_id
+    */
+   const_iterator
+   find(
+      const BoxId& box_id) const;
+
+   /*!
+    * @brief Iterator to the first member with a BoxId not less than the
+    * BoxId of the argument Box.
+    *
+    * @param[in] box
+    */
+   const_iterator
+   lowerBound(
+      const Box& box) const;
+
+   /*!
+    * @brief Iterator to the first member with a BoxId greater than the
+    * BoxId of the argument Box.
+    *
+    * @param[in] box
+    */
+   const_iterator
+   upperBound(
+      const Box& box) const;
+
+   /*!
+    * @brief Count total number of indices in the boxes in the container.
+    */
+   size_t
+   getTotalSizeOfBoxes() const;
+
+   /*!
+    * @brief Find all boxes that intersect with a given box.
+    *
+    * A pointer to every member that intersects with the box argument
+    * is appended to overlap_boxes, in BoxId order.  This is a linear scan
+    * over contiguous memory; for repeated searches of a large container
+    * build a BoxContainer with a search tree instead.
+    *
+    * @param[out] overlap_boxes
+    *
+    * @param[in] box
+    */
+   void
+   findOverlapBoxes(
+      std::vector<const Box *>& overlap_boxes,
+      const Box& box) const;
+
+   /*!
+    * @brief Copy all members into a BoxContainer.
+    *
+    * The output is cleared and left ordered.  Since the members are
+    * already sorted, this is O(N).
+    *
+    * @param[out] boxes
+    */
+   void
+   getBoxes(
+      BoxContainer& boxes) const;
+
+   /*!
+    * @brief Print each box in the container to the specified output stream.
+    *
+    * @param[in] os
+    * @param[in] border
+    */
+   void
+   print(
+      std::ostream& os = tbox::plog,
+      const std::string& border = std::string()) const;
+
+private:
+   /*!
+    * @brief Comparison of a member's BoxId against a BoxId key.
+    */
+   struct id_less_than {
+      bool
+      operator () (
+         const Box& box,
+         const BoxId& box_id) const
+      {
+         return box.getBoxId() < box_id;
+      }
+   };
+
+   /*!
+    * @brief Sort the members by BoxId and remove duplicate BoxIds,
+    * keeping the first of each.
+    */
+   void
+   sortAndRemoveDuplicates();
+
+   /*!
+    * @brief The member Boxes, sorted by BoxId.
+    */
+   std::vector<Box> d_boxes;
+};
+
+}
+}
+
+#endif
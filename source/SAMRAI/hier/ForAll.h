@@ -15,6 +15,7 @@
 
 #if defined(HAVE_RAJA)
 #include "RAJA/RAJA.hpp"
+#endif
 
 #include "SAMRAI/hier/Box.h"
 #include "SAMRAI/hier/Index.h"
@@ -62,6 +63,12 @@ namespace hier
  *
  * \endverbatim
  *
+ * When SAMRAI is built without RAJA the same interface is available for
+ * the tbox::policy tags.  tbox::policy::sequential executes plain nested
+ * loops, while tbox::policy::parallel distributes the outermost loop among
+ * OpenMP threads if OpenMP is enabled, and is sequential otherwise.  The
+ * loop body must then be safe to execute concurrently for distinct
+ * indices.
  */
 
 namespace detail
@@ -103,6 +110,8 @@ struct function_traits<R (T::*)(Args...) const> {
    enum { argument_count = sizeof...(Args) };
 };
 
+#if defined(HAVE_RAJA)
+
 inline RAJA::RangeSegment make_range(const hier::Index& ifirst, const hier::Index& ilast, std::size_t index)
 {
    return RAJA::RangeSegment(ifirst(index), ilast(index) + 1);
@@ -181,8 +190,91 @@ struct for_all<3> {
    }
 };
 
+#else  // !HAVE_RAJA
+
+/*
+ * Host loop over [begin,end) for a policy.  Only tbox::policy::parallel
+ * with OpenMP opens a parallel region; every other policy runs a plain
+ * loop.
+ */
+template <typename Policy>
+struct host_for {
+   template <typename LoopBody>
+   inline static void eval(int begin, int end, LoopBody body)
+   {
+      for (int i = begin; i < end; ++i) {
+         body(i);
+      }
+   }
+};
+
+#if defined(HAVE_OPENMP)
+template <>
+struct host_for<tbox::policy::parallel> {
+   template <typename LoopBody>
+   inline static void eval(int begin, int end, LoopBody body)
+   {
+#pragma omp parallel for
+      for (int i = begin; i < end; ++i) {
+         body(i);
+      }
+   }
+};
+#endif
+
+template <int ArgumentCount>
+struct for_all {
+};
+
+template <>
+struct for_all<1> {
+   template <typename Policy, typename LoopBody>
+   inline static void eval(const hier::Index& ifirst, const hier::Index& ilast, LoopBody body)
+   {
+      host_for<Policy>::eval(ifirst(0), ilast(0) + 1, body);
+   }
+};
+
+template <>
+struct for_all<2> {
+   template <typename Policy, typename LoopBody>
+   inline static void eval(const hier::Index& ifirst, const hier::Index& ilast, LoopBody body)
+   {
+      const int i0 = ifirst(0);
+      const int i1 = ilast(0);
+      host_for<Policy>::eval(ifirst(1), ilast(1) + 1, [&](int j) {
+         for (int i = i0; i <= i1; ++i) {
+            body(i, j);
+         }
+      });
+   }
+};
+
+template <>
+struct for_all<3> {
+   template <typename Policy, typename LoopBody>
+   inline static void eval(const hier::Index& ifirst, const hier::Index& ilast, LoopBody body)
+   {
+      const int i0 = ifirst(0);
+      const int i1 = ilast(0);
+      const int j0 = ifirst(1);
+      const int j1 = ilast(1);
+      host_for<Policy>::eval(ifirst(2), ilast(2) + 1, [&](int k) {
+         for (int j = j0; j <= j1; ++j) {
+            for (int i = i0; i <= i1; ++i) {
+               body(i, j, k);
+            }
+         }
+      });
+   }
+};
+
+#endif  // HAVE_RAJA
+
 }  // namespace detail
 
+#if defined(HAVE_RAJA)
+
 // does NOT include end
 template <typename Policy, typename LoopBody,
           typename std::enable_if<std::is_base_of<tbox::policy::base, Policy>::value, int>::type = 0>
@@ -198,6 +290,17 @@ inline void for_all(int begin, int end, LoopBody body)
    RAJA::forall<Policy>(RAJA::RangeSegment(begin, end), body);
 }
 
+#else
+
+// does NOT include end
+template <typename Policy, typename LoopBody>
+inline void for_all(int begin, int end, LoopBody body)
+{
+   detail::host_for<Policy>::eval(begin, end, body);
+}
+
+#endif  // HAVE_RAJA
+
 // does NOT include end
 template <typename LoopBody>
 inline void parallel_for_all(int begin, int end, LoopBody body)
@@ -233,6 +336,4 @@ inline void parallel_for_all(const hier::Box& box, LoopBody body)
 }  // namespace hier
 }  // namespace SAMRAI
 
-#endif
-
 #endif  // included_hier_ForAll
@@ -0,0 +1,272 @@
+/*************************************************************************
+ *
+ * This file is part of the SAMRAI distribution.  For full copyright
+ * information, see COPYRIGHT and LICENSE.
+ *
+ * Copyright:     (c) 1997-2020 Lawrence Livermore National Security, LLC
+ * Description:   Box index iteration with the dimension fixed at compile
+ *                time.
+ *
+ ************************************************************************/
+
+#ifndef included_hier_ForEachIndex
+#define included_hier_ForEachIndex
+
+#include "SAMRAI/SAMRAI_config.h"
+
+#include "SAMRAI/hier/Box.h"
+#include "SAMRAI/hier/Index.h"
+#include "SAMRAI/tbox/Utilities.h"
+
+#include <iterator>
+
+namespace SAMRAI {
+namespace hier {
+
+/*!
+ * Index loops over a hier::Box whose dimension is a template argument.
+ *
+ * BoxIterator works for any dimension, so each increment runs a carry
+ * loop whose length is only known at run time, and each comparison
+ * checks every component of the Index.  Compilers rarely turn that into
+ * nested loops.  The facilities here visit the indices in the same
+ * column-major order but with the dimension known to the compiler:
+ *
+ * for_each_index<DIM>() runs the loop body on every index of the box
+ * as plain nested loops, the innermost over direction 0.  The body is
+ * called with a const reference to an Index whose components are the
+ * loop counters.
+ *
+ * \verbatim
+ *
+ * hier::for_each_index<3>(box, [&](const hier::Index& i) {
+ *    dst(i, d) = src(i, d);
+ * });
+ *
+ * \endverbatim
+ *
+ * for_each_index() without a template argument selects the
+ * dimension-specialized loop from the dimension of the box, so code
+ * written for any dimension still gets the nested loops in 1, 2 and 3
+ * dimensions, and falls back to BoxIterator above that.
+ *
+ * FixedDimBoxIterator<DIM> is an iterator with the same interface as
+ * BoxIterator for loops that cannot be written as a loop body, for
+ * example loops that stop early.
+ */
+
+namespace detail {
+
+template <int D>
+struct for_each_index_loop {
+   template <typename LoopBody>
+   inline static void eval(
+      Index& index,
+      const Index& lower,
+      const Index& upper,
+      LoopBody& body)
+   {
+      const int lo = lower(D - 1);
+      const int hi = upper(D - 1);
+      for (int i = lo; i <= hi; ++i) {
+         index(D - 1) = i;
+         for_each_index_loop<D - 1>::eval(index, lower, upper, body);
+      }
+   }
+};
+
+template <>
+struct for_each_index_loop<1> {
+   template <typename LoopBody>
+   inline static void eval(
+      Index& index,
+      const Index& lower,
+      const Index& upper,
+      LoopBody& body)
+   {
+      const int lo = lower(0);
+      const int hi = upper(0);
+      for (int i = lo; i <= hi; ++i) {
+         index(0) = i;
+         body(static_cast<const Index&>(index));
+      }
+   }
+};
+
+}  // namespace detail
+
+/*!
+ * @brief Call body(index) for every index of the box, in column-major
+ * order, using DIM nested loops.
+ *
+ * @pre box.getDim().getValue() == DIM
+ */
+template <int DIM, typename LoopBody>
+inline void for_each_index(const Box& box, LoopBody body)
+{
+   TBOX_ASSERT(box.getDim().getValue() == DIM);
+   if (!box.empty()) {
+      Index index(box.lower());
+      detail::for_each_index_loop<DIM>::eval(index,
+         box.lower(), box.upper(), body);
+   }
+}
+
+/*!
+ * @brief Call body(index) for every index of the box, in column-major
+ * order, choosing the loop from the dimension of the box.
+ */
+template <typename LoopBody>
+inline void for_each_index(const Box& box, LoopBody body)
+{
+   switch (box.getDim().getValue()) {
+      case 1:
+         for_each_index<1>(box, body);
+         break;
+      case 2:
+         for_each_index<2>(box, body);
+         break;
+      case 3:
+         for_each_index<3>(box, body);
+         break;
+      default: {
+         Box::iterator iend(box.end());
+         for (Box::iterator i(box.begin()); i != iend; ++i) {
+            body(*i);
+         }
+      }
+   }
+}
+
+/**
+ * Class FixedDimBoxIterator<DIM> steps through the indices of a box in
+ * the same column-major order as BoxIterator, for a box of dimension
+ * DIM.  It keeps only the bounds of the box rather than a copy of it,
+ * and the carry from one direction to the next is a loop of fixed
+ * length that the compiler unrolls.  The iterator should be used as
+ * follows:
+ * \verbatim
+ * Box box;
+ * ...
+ * FixedDimBoxIterator<2> bend(box, false);
+ * for (FixedDimBoxIterator<2> b(box, true); b != bend; ++b) {
+ *    // use index b of the box
+ * }
+ * \endverbatim
+ *
+ * @see BoxIterator
+ * @see for_each_index
+ */
+template <int DIM>
+class FixedDimBoxIterator : public std::iterator<std::forward_iterator_tag, Index>
+{
+public:
+   /**
+    * Constructor for the iterator.  If begin is true the iterator points
+    * to the first index of the box, otherwise it is the end iterator.
+    *
+    * @pre box.getDim().getValue() == DIM
+    */
+   FixedDimBoxIterator(
+      const Box& box,
+      bool begin):
+      d_index(box.lower())
+   {
+      TBOX_ASSERT(box.getDim().getValue() == DIM);
+      for (int i = 0; i < DIM; ++i) {
+         d_lower[i] = box.lower(static_cast<tbox::Dimension::dir_t>(i));
+         d_upper[i] = box.upper(static_cast<tbox::Dimension::dir_t>(i));
+      }
+      if (!box.empty() && !begin) {
+         d_index(DIM - 1) = d_upper[DIM - 1] + 1;
+      }
+   }
+
+   /**
+    * Return the current index in the box.  This operation is undefined
+    * if the iterator is past the last Index in the box.
+    */
+   const Index&
+   operator * () const
+   {
+      return d_index;
+   }
+
+   /**
+    * Return a pointer to the current index in the box.  This operation is
+    * undefined if the iterator is past the last Index in the box.
+    */
+   const Index *
+   operator -> () const
+   {
+      return &d_index;
+   }
+
+   /**
+    * Pre-increment the iterator to point to the next index in the box.
+    */
+   FixedDimBoxIterator&
+   operator ++ ()
+   {
+      ++d_index(0);
+      for (int i = 0; i < DIM - 1; ++i) {
+         if (d_index(i) > d_upper[i]) {
+            d_index(i) = d_lower[i];
+            ++d_index(i + 1);
+         } else {
+            break;
+         }
+      }
+      return *this;
+   }
+
+   /**
+    * Post-increment the iterator to point to the next index in the box.
+    */
+   FixedDimBoxIterator
+   operator ++ (
+      int)
+   {
+      FixedDimBoxIterator tmp = *this;
+      ++(*this);
+      return tmp;
+   }
+
+   /**
+    * Test two iterators for equality (same index value).
+    */
+   bool
+   operator == (
+      const FixedDimBoxIterator& iterator) const
+   {
+      for (int i = 0; i < DIM; ++i) {
+         if (d_index(i) != iterator.d_index(i)) {
+            return false;
+         }
+      }
+      return true;
+   }
+
+   /**
+    * Test two iterators for inequality (different index values).
+    */
+   bool
+   operator != (
+      const FixedDimBoxIterator& iterator) const
+   {
+      return !(*this == iterator);
+   }
+
+private:
+   Index d_index;
+
+   int d_lower[DIM];
+
+   int d_upper[DIM];
+
+};
+
+}
+}
+
+#endif
@@ -19,6 +19,7 @@
 #include "SAMRAI/tbox/MathUtilities.h"
 #include "SAMRAI/tbox/Utilities.h"
 
+#include <atomic>
 #include <vector>
 #include <iostream>
 
@@ -1188,10 +1189,194 @@ public:
       std::ostream& s,
       const IntVector& rhs);
 
+#ifdef BOX_TELEMETRY
+   // These are to optionally track the cumulative number of IntVectors
+   // constructed and the cumulative number of those whose components did
+   // not fit in the inline storage and were allocated on the heap.  They
+   // are atomic because IntVectors are made on several threads at once.
+   static std::atomic<int> s_cumulative_constructed_ct;
+
+   static std::atomic<int> s_cumulative_heap_allocated_ct;
+#endif
+
 private:
 
    typedef struct MaxIntArray { int d_array[3]; } MaxIntArray;
 
+   /*!
+    * @brief Storage for the integer components of an IntVector.
+    *
+    * Up to SAMRAI::MAX_DIM_VAL values, which is everything needed by an
+    * IntVector sized for one block, are held in an array inside the
+    * object, so creating, copying and destroying such IntVectors never
+    * touches the heap.  Only IntVectors sized for more than one block
+    * spill their values into heap memory.
+    */
+   class ComponentStorage
+   {
+public:
+      explicit ComponentStorage(
+         size_t size):
+         d_size(0),
+         d_data(d_inline)
+      {
+         allocate(size);
+#ifdef BOX_TELEMETRY
+         ++s_cumulative_constructed_ct;
+#endif
+      }
+
+      ComponentStorage(
+         size_t size,
+         int value):
+         d_size(0),
+         d_data(d_inline)
+      {
+         allocate(size);
+#ifdef BOX_TELEMETRY
+         ++s_cumulative_constructed_ct;
+#endif
+         for (size_t i = 0; i < d_size; ++i) {
+            d_data[i] = value;
+         }
+      }
+
+      ComponentStorage(
+         const ComponentStorage& other):
+         d_size(0),
+         d_data(d_inline)
+      {
+         allocate(other.d_size);
+#ifdef BOX_TELEMETRY
+         ++s_cumulative_constructed_ct;
+#endif
+         for (size_t i = 0; i < d_size; ++i) {
+            d_data[i] = other.d_data[i];
+         }
+      }
+
+      ~ComponentStorage()
+      {
+         if (d_data != d_inline) {
+            delete[] d_data;
+         }
+      }
+
+      ComponentStorage&
+      operator = (
+         const ComponentStorage& rhs)
+      {
+         if (this != &rhs) {
+            if (d_size != rhs.d_size) {
+               deallocate();
+               allocate(rhs.d_size);
+            }
+            for (size_t i = 0; i < d_size; ++i) {
+               d_data[i] = rhs.d_data[i];
+            }
+         }
+         return *this;
+      }
+
+      ComponentStorage&
+      operator = (
+         const std::vector<int>& rhs)
+      {
+         if (d_size != rhs.size()) {
+            deallocate();
+            allocate(rhs.size());
+         }
+         for (size_t i = 0; i < d_size; ++i) {
+            d_data[i] = rhs[i];
+         }
+         return *this;
+      }
+
+      int&
+      operator [] (
+         size_t i)
+      {
+         return d_data[i];
+      }
+
+      const int&
+      operator [] (
+         size_t i) const
+      {
+         return d_data[i];
+      }
+
+      size_t
+      size() const
+      {
+         return d_size;
+      }
+
+      /*
+       * Change the number of values, keeping the leading values that are
+       * common to the old and new sizes.
+       */
+      void
+      resize(
+         size_t size)
+      {
+         if (size == d_size) {
+            return;
+         }
+         int* old_data = d_data;
+         const size_t old_size = d_size;
+         if (size > SAMRAI::MAX_DIM_VAL || old_data != d_inline) {
+            allocate(size);
+            for (size_t i = 0; i < d_size && i < old_size; ++i) {
+               d_data[i] = old_data[i];
+            }
+            if (old_data != d_inline) {
+               delete[] old_data;
+            }
+         } else {
+            d_size = size;
+         }
+         for (size_t i = old_size; i < d_size; ++i) {
+            d_data[i] = 0;
+         }
+      }
+
+private:
+      void
+      allocate(
+         size_t size)
+      {
+         d_size = size;
+         if (size > SAMRAI::MAX_DIM_VAL) {
+            d_data = new int[size];
+#ifdef BOX_TELEMETRY
+            ++s_cumulative_heap_allocated_ct;
+#endif
+         } else {
+            d_data = d_inline;
+         }
+      }
+
+      void
+      deallocate()
+      {
+         if (d_data != d_inline) {
+            delete[] d_data;
+            d_data = d_inline;
+         }
+         d_size = 0;
+      }
+
+      size_t d_size;
+
+      /*
+       * Points to d_inline or to heap memory owned by this object.
+       */
+      int* d_data;
+
+      int d_inline[SAMRAI::MAX_DIM_VAL];
+   };
+
    /*
     * Unimplemented default constructor
     */
@@ -1218,7 +1403,7 @@ private:
 
    size_t d_num_blocks;
 
-   std::vector<int> d_vector;
+   ComponentStorage d_vector;
 
    static IntVector* s_zeros[SAMRAI::MAX_DIM_VAL];
    static IntVector* s_ones[SAMRAI::MAX_DIM_VAL];
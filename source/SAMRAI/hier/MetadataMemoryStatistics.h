@@ -0,0 +1,215 @@
+/*************************************************************************
+ *
+ * This file is part of the SAMRAI distribution.  For full copyright
+ * information, see COPYRIGHT and LICENSE.
+ *
+ * Copyright:     (c) 1997-2020 Lawrence Livermore National Security, LLC
+ * Description:   Memory used by mesh metadata, by category.
+ *
+ ************************************************************************/
+#ifndef included_hier_MetadataMemoryStatistics
+#define included_hier_MetadataMemoryStatistics
+
+#include "SAMRAI/SAMRAI_config.h"
+
+#include "SAMRAI/tbox/SAMRAI_MPI.h"
+#include "SAMRAI/tbox/StartupShutdownManager.h"
+#include "SAMRAI/tbox/Utilities.h"
+
+#include <iostream>
+#include <string>
+
+namespace SAMRAI {
+namespace hier {
+
+class BoxLevel;
+class Connector;
+
+/*!
+ * @brief A utility for accumulating and writing out the memory used
+ * by mesh metadata, such as BoxLevels, Connectors, search trees and
+ * communication schedules.
+ *
+ * Objects holding metadata add their bytes to the categories below,
+ * for example through PatchHierarchy::computeMemoryFootprint() or
+ * xfer::RefineSchedule::computeMemoryFootprint().  The local totals
+ * can then be printed with global min/max/sum, in the same form as
+ * BoxLevelStatistics and ConnectorStatistics, or recorded with the
+ * tbox::Statistician.
+ *
+ * The byte counts are estimates.  Container overheads are modelled,
+ * not measured, and memory shared by several objects is only counted
+ * once if the objects are added through the methods that know about
+ * the sharing.
+ */
+class MetadataMemoryStatistics
+{
+
+public:
+   /*!
+    * @brief Categories of metadata memory.
+    */
+   enum Category { BOX_STORAGE,
+                   NEIGHBORHOODS,
+                   SEARCH_TREES,
+                   TRANSACTIONS,
+                   MESSAGE_BUFFERS,
+
+                   NUMBER_OF_CATEGORIES };
+
+   /*!
+    * @brief Constructor.
+    *
+    * @param[in] mpi The processes over which printMemoryStats()
+    * reduces the local byte counts.
+    */
+   explicit MetadataMemoryStatistics(
+      const tbox::SAMRAI_MPI& mpi);
+
+   /*!
+    * @brief Add to the local bytes of a category.
+    *
+    * @param[in] category
+    * @param[in] bytes
+    *
+    * @pre category >= 0 && category < NUMBER_OF_CATEGORIES
+    */
+   void
+   addBytes(
+      Category category,
+      size_t bytes)
+   {
+      TBOX_ASSERT(category >= 0 && category < NUMBER_OF_CATEGORIES);
+      d_bytes[category] += bytes;
+   }
+
+   /*!
+    * @brief Add the Boxes, search trees and persistent overlap
+    * Connectors of a BoxLevel.
+    *
+    * @param[in] box_level
+    */
+   void
+   addBoxLevel(
+      const BoxLevel& box_level);
+
+   /*!
+    * @brief Add the relationships of a Connector that is not held by
+    * any BoxLevel's PersistentOverlapConnectors.
+    *
+    * @param[in] connector
+    */
+   void
+   addConnector(
+      const Connector& connector);
+
+   /*!
+    * @brief Return the local bytes of a category.
+    *
+    * @param[in] category
+    *
+    * @pre category >= 0 && category < NUMBER_OF_CATEGORIES
+    */
+   size_t
+   getLocalBytes(
+      Category category) const
+   {
+      TBOX_ASSERT(category >= 0 && category < NUMBER_OF_CATEGORIES);
+      return d_bytes[category];
+   }
+
+   /*!
+    * @brief Return the local bytes of all categories.
+    */
+   size_t
+   getLocalTotalBytes() const;
+
+   /*!
+    * @brief Set all local byte counts to zero.
+    */
+   void
+   reset();
+
+   /*!
+    * @brief Record the local byte counts with the tbox::Statistician.
+    *
+    * One processor statistic named prefix + category name is recorded
+    * for each category plus one for the total.  Each call appends one
+    * value to each statistic's sequence.
+    *
+    * @param[in] prefix
+    */
+   void
+   recordStatistics(
+      const std::string& prefix) const;
+
+   /*!
+    * @brief Print out local and globally reduced byte counts.
+    *
+    * All processes in the SAMRAI_MPI given to the constructor must
+    * call this method because it requires collective communication.
+    *
+    * @param[in,out] os The output stream
+    *
+    * @param[in] border A string to print at the start of every line
+    * in the output.
+    */
+   void
+   printMemoryStats(
+      std::ostream& os,
+      const std::string& border) const;
+
+   /*!
+    * @brief Return the name of a category.
+    *
+    * @pre category >= 0 && category < NUMBER_OF_CATEGORIES
+    */
+   static const std::string&
+   getCategoryName(
+      Category category)
+   {
+      TBOX_ASSERT(category >= 0 && category < NUMBER_OF_CATEGORIES);
+      return s_category_names[category];
+   }
+
+private:
+   /*!
+    * @brief Set up things for the entire class.
+    *
+    * Only called by StartupShutdownManager.
+    */
+   static void
+   initializeCallback();
+
+   /*!
+    * @brief Free static data.
+    *
+    * Only called by StartupShutdownManager.
+    */
+   static void
+   finalizeCallback();
+
+   tbox::SAMRAI_MPI d_mpi;
+
+   //! @brief Local bytes by category.
+   size_t d_bytes[NUMBER_OF_CATEGORIES];
+
+   /*!
+    * @brief Names of the categories.
+    */
+   static std::string s_category_names[NUMBER_OF_CATEGORIES];
+
+   /*!
+    * @brief Longest length in s_category_names.
+    */
+   static int s_longest_length;
+
+   static tbox::StartupShutdownManager::Handler
+      s_initialize_finalize_handler;
+
+};
+
+}
+}
+
+#endif  // included_hier_MetadataMemoryStatistics
@@ -71,6 +71,13 @@ private:
     */
    MultiblockBoxTree();
 
+   /*!
+    * @brief Return the number of bytes allocated by the single-block
+    * trees and the container holding them.
+    */
+   size_t
+   getMemoryFootprint() const;
+
    /*!
     * @brief Return whether the tree contains any Boxes with the
     * given BlockId.
@@ -240,6 +247,31 @@ private:
       const IntVector& refinement_ratio,
       bool include_singularity_block_neighbors = false) const;
 
+   /*!
+    * @brief Find all boxes that intersect with each of the given boxes.
+    *
+    * Batched version of findOverlapBoxes with refinement ratio.  Boxes
+    * intersecting boxes[i], in its own block or across block
+    * boundaries, are added to overlap_boxes[i], which keeps its
+    * ordered/unordered state.
+    *
+    * @param[in,out] overlap_boxes
+    *
+    * @param[in]  boxes
+    *
+    * @param[in]  refinement_ratio
+    *
+    * @param[in]  include_singularity_block_neighbors
+    *
+    * @pre overlap_boxes.size() == boxes.size()
+    */
+   void
+   findOverlapBoxes(
+      std::vector<BoxContainer>& overlap_boxes,
+      const std::vector<Box>& boxes,
+      const IntVector& refinement_ratio,
+      bool include_singularity_block_neighbors = false) const;
+
    //@}
 
 private:
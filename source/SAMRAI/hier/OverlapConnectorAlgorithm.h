@@ -62,6 +62,10 @@ public:
     * If the Connector's head is not GLOBALIZED, a copy is made and
     * globalized.  Once a globalized head is obtained, this method
     * simply calls findOverlaps(const BoxLevel &globalized_head).
+    * If globalization is forbidden (see
+    * BoxLevel::setAllowGlobalization()), overlaps with a DISTRIBUTED
+    * head are found by findOverlaps_assumedPartition() instead, which
+    * requires all processes to make the call.
     *
     * @param[in,out] connector
     * @param[in] base_box_level
@@ -89,6 +93,10 @@ public:
     * If the Connector's head is not GLOBALIZED, a copy is made and
     * globalized.  Once a globalized head is obtained, this method
     * simply calls findOverlaps(const BoxLevel &globalized_head).
+    * If globalization is forbidden (see
+    * BoxLevel::setAllowGlobalization()), overlaps with a DISTRIBUTED
+    * head are found by findOverlaps_assumedPartition() instead, which
+    * requires all processes to make the call.
     *
     * @param[in,out] connector
     * @param[in] base_box_level
@@ -117,6 +125,10 @@ public:
     * If the Connector's head is not GLOBALIZED, a copy is made and
     * globalized.  Once a globalized head is obtained, this method
     * simply calls findOverlaps(const BoxLevel &globalized_head).
+    * If globalization is forbidden (see
+    * BoxLevel::setAllowGlobalization()), overlaps with a DISTRIBUTED
+    * head are found by findOverlaps_assumedPartition() instead, which
+    * requires all processes to make the call.
     *
     * @param[in,out] connector
     * @param[in] ignore_self_overlap
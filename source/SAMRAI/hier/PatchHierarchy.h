@@ -1088,6 +1088,21 @@ public:
       return d_dim;
    }
 
+   /*!
+    * @brief Add the memory used by the hierarchy's metadata to stats.
+    *
+    * Walks the levels, adding each level's metadata as
+    * PatchLevel::computeMemoryFootprint() does, and the domain
+    * BoxLevel.  Requires no communication; use
+    * MetadataMemoryStatistics::printMemoryStats() to see the global
+    * distribution.
+    *
+    * @param[in,out] stats
+    */
+   void
+   computeMemoryFootprint(
+      MetadataMemoryStatistics& stats) const;
+
    /*!
     * @brief Print a patch hierarchy to a specified degree of detail.
     *
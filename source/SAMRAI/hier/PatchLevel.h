@@ -15,6 +15,7 @@
 
 #include "SAMRAI/hier/BoxContainerSingleBlockIterator.h"
 #include "SAMRAI/hier/BoxLevel.h"
+#include "SAMRAI/hier/MetadataMemoryStatistics.h"
 #include "SAMRAI/hier/PatchFactory.h"
 #include "SAMRAI/hier/ProcessorMapping.h"
 #include "SAMRAI/tbox/Utilities.h"
@@ -1101,6 +1102,20 @@ public:
    putToRestart(
       const std::shared_ptr<tbox::Database>& restart_db) const;
 
+   /*!
+    * @brief Add the memory used by the level's metadata to stats.
+    *
+    * This counts the level's BoxLevel, with its persistent overlap
+    * Connectors, the globalized Boxes made by getBoxes() if they exist
+    * and the physical domain.  It does not cause globalization and
+    * requires no communication.
+    *
+    * @param[in,out] stats
+    */
+   void
+   computeMemoryFootprint(
+      MetadataMemoryStatistics& stats) const;
+
    /*!
     * @brief Print a patch level to varying details.
     *
@@ -288,6 +288,16 @@ private:
    void
    clear();
 
+   /*!
+    * @brief Return an estimate of the number of bytes allocated by the
+    * Connectors incident from the BoxLevel.
+    *
+    * Connectors incident to the BoxLevel are not counted because they
+    * are counted by their base BoxLevel's PersistentOverlapConnectors.
+    */
+   size_t
+   getMemoryFootprint() const;
+
    const BoxLevel&
    myBoxLevel()
    {
@@ -336,7 +346,8 @@ private:
    /*
     * @brief Make sure all base boxes have a neighbor set or remove
     * empty neighbor sets, depending on
-    * s_create_empty_neighbor_containers.
+    * s_create_empty_neighbor_containers, then freeze the Connector's
+    * neighborhoods.
     */
    void
    postprocessForEmptyNeighborContainers(
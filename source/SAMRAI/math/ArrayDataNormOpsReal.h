@@ -34,6 +34,12 @@ namespace math {
  * intersection of the box in the function argument list and the boxes
  * associated with all pdat::ArrayData<TYPE> objects.
  *
+ * The operations linearSumAndDot(), linearSumAndWeightedL2Norm() and
+ * scaleAndMaxNorm() update the destination array and compute a norm or dot
+ * product of the result in the same sweep.  These operations are bound by
+ * memory bandwidth, so reading the arrays once instead of twice makes them
+ * substantially faster than the update followed by the separate reduction.
+ *
  * These operations typically apply only to the numerical standard built-in
  * types, such as double, float, and the complex type (which may or may not
  * be a built-in type depending on the C++ compiler).  This templated
@@ -215,6 +221,140 @@ public:
       const pdat::ArrayData<TYPE>& data2,
       const hier::Box& box) const;
 
+   /**
+    * Set dst = alpha * src1 + beta * src2, elementwise, and return the
+    * dot product of the new dst with data using the control volume,
+    * \f$\sum_i ( dst_i * data_i * cvol_i )\f$, in a single pass over the
+    * arrays.  Only the intersection of box with the boxes of all the arrays,
+    * including the control volume, is updated.  The data may be the same
+    * array as dst.
+    *
+    * @pre (dst.getDim() == src1.getDim()) &&
+    *      (dst.getDim() == src2.getDim()) &&
+    *      (dst.getDim() == data.getDim()) &&
+    *      (dst.getDim() == cvol.getDim()) && (dst.getDim() == box.getDim())
+    * @pre (dst.getDepth() == src1.getDepth()) &&
+    *      (dst.getDepth() == src2.getDepth()) &&
+    *      (dst.getDepth() == data.getDepth())
+    */
+   TYPE
+   linearSumAndDotWithControlVolume(
+      pdat::ArrayData<TYPE>& dst,
+      const TYPE& alpha,
+      const pdat::ArrayData<TYPE>& src1,
+      const TYPE& beta,
+      const pdat::ArrayData<TYPE>& src2,
+      const pdat::ArrayData<TYPE>& data,
+      const pdat::ArrayData<double>& cvol,
+      const hier::Box& box) const;
+
+   /**
+    * Set dst = alpha * src1 + beta * src2, elementwise, and return the
+    * dot product of the new dst with data, \f$\sum_i ( dst_i * data_i )\f$,
+    * in a single pass over the arrays.  Only the intersection of box with
+    * the boxes of all the arrays is updated.  The data may be the same
+    * array as dst.
+    *
+    * @pre (dst.getDim() == src1.getDim()) &&
+    *      (dst.getDim() == src2.getDim()) &&
+    *      (dst.getDim() == data.getDim()) && (dst.getDim() == box.getDim())
+    * @pre (dst.getDepth() == src1.getDepth()) &&
+    *      (dst.getDepth() == src2.getDepth()) &&
+    *      (dst.getDepth() == data.getDepth())
+    */
+   TYPE
+   linearSumAndDot(
+      pdat::ArrayData<TYPE>& dst,
+      const TYPE& alpha,
+      const pdat::ArrayData<TYPE>& src1,
+      const TYPE& beta,
+      const pdat::ArrayData<TYPE>& src2,
+      const pdat::ArrayData<TYPE>& data,
+      const hier::Box& box) const;
+
+   /**
+    * Set dst = alpha * src1 + beta * src2, elementwise, and return the
+    * weighted \f$L_2\f$-norm of the new dst using the control volume,
+    * \f$\sqrt{ \sum_i ( (dst_i * weight_i)^2 cvol_i ) }\f$, in a single pass
+    * over the arrays.  Only the intersection of box with the boxes of all
+    * the arrays, including the control volume, is updated.
+    *
+    * @pre (dst.getDim() == src1.getDim()) &&
+    *      (dst.getDim() == src2.getDim()) &&
+    *      (dst.getDim() == weight.getDim()) &&
+    *      (dst.getDim() == cvol.getDim()) && (dst.getDim() == box.getDim())
+    * @pre (dst.getDepth() == src1.getDepth()) &&
+    *      (dst.getDepth() == src2.getDepth()) &&
+    *      (dst.getDepth() == weight.getDepth())
+    */
+   double
+   linearSumAndWeightedL2NormWithControlVolume(
+      pdat::ArrayData<TYPE>& dst,
+      const TYPE& alpha,
+      const pdat::ArrayData<TYPE>& src1,
+      const TYPE& beta,
+      const pdat::ArrayData<TYPE>& src2,
+      const pdat::ArrayData<TYPE>& weight,
+      const pdat::ArrayData<double>& cvol,
+      const hier::Box& box) const;
+
+   /**
+    * Set dst = alpha * src1 + beta * src2, elementwise, and return the
+    * weighted \f$L_2\f$-norm of the new dst,
+    * \f$\sqrt{ \sum_i ( (dst_i * weight_i)^2 ) }\f$, in a single pass over
+    * the arrays.  Only the intersection of box with the boxes of all the
+    * arrays is updated.
+    *
+    * @pre (dst.getDim() == src1.getDim()) &&
+    *      (dst.getDim() == src2.getDim()) &&
+    *      (dst.getDim() == weight.getDim()) && (dst.getDim() == box.getDim())
+    * @pre (dst.getDepth() == src1.getDepth()) &&
+    *      (dst.getDepth() == src2.getDepth()) &&
+    *      (dst.getDepth() == weight.getDepth())
+    */
+   double
+   linearSumAndWeightedL2Norm(
+      pdat::ArrayData<TYPE>& dst,
+      const TYPE& alpha,
+      const pdat::ArrayData<TYPE>& src1,
+      const TYPE& beta,
+      const pdat::ArrayData<TYPE>& src2,
+      const pdat::ArrayData<TYPE>& weight,
+      const hier::Box& box) const;
+
+   /**
+    * Set dst = alpha * src, elementwise, and return the \f$\max\f$-norm of
+    * the new dst over the elements where \f$cvol_i > 0\f$, in a single pass
+    * over the arrays.  Only the intersection of box with the boxes of all
+    * the arrays, including the control volume, is updated.
+    *
+    * @pre (dst.getDim() == src.getDim()) &&
+    *      (dst.getDim() == cvol.getDim()) && (dst.getDim() == box.getDim())
+    * @pre dst.getDepth() == src.getDepth()
+    */
+   double
+   scaleAndMaxNormWithControlVolume(
+      pdat::ArrayData<TYPE>& dst,
+      const TYPE& alpha,
+      const pdat::ArrayData<TYPE>& src,
+      const pdat::ArrayData<double>& cvol,
+      const hier::Box& box) const;
+
+   /**
+    * Set dst = alpha * src, elementwise, and return the \f$\max\f$-norm of
+    * the new dst, in a single pass over the arrays.  Only the intersection
+    * of box with the boxes of both arrays is updated.
+    *
+    * @pre (dst.getDim() == src.getDim()) && (dst.getDim() == box.getDim())
+    * @pre dst.getDepth() == src.getDepth()
+    */
+   double
+   scaleAndMaxNorm(
+      pdat::ArrayData<TYPE>& dst,
+      const TYPE& alpha,
+      const pdat::ArrayData<TYPE>& src,
+      const hier::Box& box) const;
+
    /**
     * Return the integral of the function based on the data array.
     * The return value is the sum \f$\sum_i ( data_i * vol_i )\f$.
@@ -14,6 +14,7 @@
 #include "SAMRAI/SAMRAI_config.h"
 
 #include "SAMRAI/hier/PatchHierarchy.h"
+#include "SAMRAI/tbox/ReductionBatch.h"
 
 #include <iostream>
 #include <memory>
@@ -42,6 +43,12 @@ namespace math {
  * for complex and integer hierarchy data are defined in the classes
  * HierarchyDataOpsComplex and HierarchyDataOpsInteger,
  * respectively.
+ *
+ * The norms and dot product can also be added to a tbox::ReductionBatch
+ * with addL1Norm(), addSquaredL2Norm(), addMaxNorm() and addDot().
+ * These compute the local values in one sweep each and leave the global
+ * reduction to the batch, so several reductions share one non-blocking
+ * Allreduce.
  */
 
 template<class TYPE>
@@ -387,6 +394,63 @@ public:
       const int vol_id = -1,
       bool local_only = false) const = 0;
 
+   /**
+    * Set \f$d = \alpha s_1 + \beta s_2\f$ on the patch interiors and
+    * return the dot product of the new destination with the data,
+    * \f$\sum_i ( d_i * data_i * cvol_i )\f$, reading each patch once.
+    * This gives the same result as linearSum() followed by dot(), in
+    * one sweep over the data instead of two.  If the control volume is
+    * undefined (vol_id < 0), it is ignored during the summation.  The
+    * data may be the destination.  If local_only is true, the global
+    * reduction is not performed.
+    */
+   virtual TYPE
+   linearSumAndDot(
+      const int dst_id,
+      const TYPE& alpha,
+      const int src1_id,
+      const TYPE& beta,
+      const int src2_id,
+      const int data_id,
+      const int vol_id = -1,
+      bool local_only = false) const = 0;
+
+   /**
+    * Set \f$d = \alpha s_1 + \beta s_2\f$ on the patch interiors and
+    * return the weighted \f$L_2\f$-norm of the new destination,
+    * \f$\sqrt{ \sum_i ( (d_i * weight_i)^2 cvol_i ) }\f$, reading each
+    * patch once.  This gives the same result as linearSum() followed
+    * by weightedL2Norm().  If the control volume is undefined
+    * (vol_id < 0), it is ignored during the summation.  If local_only
+    * is true, the global reduction is not performed.
+    */
+   virtual double
+   linearSumAndWeightedL2Norm(
+      const int dst_id,
+      const TYPE& alpha,
+      const int src1_id,
+      const TYPE& beta,
+      const int src2_id,
+      const int weight_id,
+      const int vol_id = -1,
+      bool local_only = false) const = 0;
+
+   /**
+    * Set \f$d = \alpha s\f$ on the patch interiors and return the
+    * \f$\max\f$-norm of the new destination, reading each patch once.
+    * This gives the same result as scale() followed by maxNorm().  If
+    * the control volume is undefined (vol_id < 0), it is ignored during
+    * the computation of the maximum.  If local_only is true, the global
+    * reduction is not performed.
+    */
+   virtual double
+   scaleAndMaxNorm(
+      const int dst_id,
+      const TYPE& alpha,
+      const int src_id,
+      const int vol_id = -1,
+      bool local_only = false) const = 0;
+
    /**
     * Return 1 if \f$\|data2_i\| > 0\f$ and \f$data1_i * data2_i \leq 0\f$, for
     * any \f$i\f$ in the set of patch data indices, where \f$cvol_i > 0\f$.  Otherwise,
@@ -475,6 +539,69 @@ public:
       const int data_id,
       const bool interior_only = true) const = 0;
 
+   /*!
+    * @brief Add the local part of L1Norm() to a batch of global
+    * reductions.
+    *
+    * @return Handle for tbox::ReductionBatch::getValue().
+    */
+   int
+   addL1Norm(
+      tbox::ReductionBatch& batch,
+      const int data_id,
+      const int vol_id = -1) const
+   {
+      return batch.addSum(L1Norm(data_id, vol_id, true));
+   }
+
+   /*!
+    * @brief Add the local part of the square of L2Norm() to a batch of
+    * global reductions.
+    *
+    * The global L2-norm is the square root of the batch's value.
+    *
+    * @return Handle for tbox::ReductionBatch::getValue().
+    */
+   int
+   addSquaredL2Norm(
+      tbox::ReductionBatch& batch,
+      const int data_id,
+      const int vol_id = -1) const
+   {
+      return batch.addSum(static_cast<double>(dot(data_id, data_id, vol_id, true)));
+   }
+
+   /*!
+    * @brief Add the local part of maxNorm() to a batch of global
+    * reductions.
+    *
+    * @return Handle for tbox::ReductionBatch::getValue().
+    */
+   int
+   addMaxNorm(
+      tbox::ReductionBatch& batch,
+      const int data_id,
+      const int vol_id = -1) const
+   {
+      return batch.addMax(maxNorm(data_id, vol_id, true));
+   }
+
+   /*!
+    * @brief Add the local part of dot() to a batch of global
+    * reductions.
+    *
+    * @return Handle for tbox::ReductionBatch::getValue().
+    */
+   int
+   addDot(
+      tbox::ReductionBatch& batch,
+      const int data1_id,
+      const int data2_id,
+      const int vol_id = -1) const
+   {
+      return batch.addSum(static_cast<double>(dot(data1_id, data2_id, vol_id, true)));
+   }
+
 private:
    // The following are not implemented
    HierarchyDataOpsReal(
@@ -513,6 +513,75 @@ public:
       const int vol_id = -1,
       bool local_only = false) const;
 
+   /**
+    * Set \f$d = \alpha s_1 + \beta s_2\f$ on the patch interiors and
+    * return the dot product of the new destination with the data,
+    * \f$\sum_i ( d_i * data_i * cvol_i )\f$, reading each patch once.
+    * This gives the same result as linearSum() followed by dot(), in
+    * one sweep over the data instead of two.  If the control volume is
+    * undefined (vol_id < 0), it is ignored during the summation.  The
+    * data may be the destination.  If local_only is true, the global
+    * reduction is not performed.
+    *
+    * @pre getPatchHierarchy()
+    * @pre (d_coarsest_level >= 0) && (d_finest_level >= d_coarsest_level) &&
+    *      (d_finest_level <= getPatchHierarchy()->getFinestLevelNumber())
+    */
+   TYPE
+   linearSumAndDot(
+      const int dst_id,
+      const TYPE& alpha,
+      const int src1_id,
+      const TYPE& beta,
+      const int src2_id,
+      const int data_id,
+      const int vol_id = -1,
+      bool local_only = false) const;
+
+   /**
+    * Set \f$d = \alpha s_1 + \beta s_2\f$ on the patch interiors and
+    * return the weighted \f$L_2\f$-norm of the new destination,
+    * \f$\sqrt{ \sum_i ( (d_i * weight_i)^2 cvol_i ) }\f$, reading each
+    * patch once.  This gives the same result as linearSum() followed
+    * by weightedL2Norm().  If the control volume is undefined
+    * (vol_id < 0), it is ignored during the summation.  If local_only
+    * is true, the global reduction is not performed.
+    *
+    * @pre getPatchHierarchy()
+    * @pre (d_coarsest_level >= 0) && (d_finest_level >= d_coarsest_level) &&
+    *      (d_finest_level <= getPatchHierarchy()->getFinestLevelNumber())
+    */
+   double
+   linearSumAndWeightedL2Norm(
+      const int dst_id,
+      const TYPE& alpha,
+      const int src1_id,
+      const TYPE& beta,
+      const int src2_id,
+      const int weight_id,
+      const int vol_id = -1,
+      bool local_only = false) const;
+
+   /**
+    * Set \f$d = \alpha s\f$ on the patch interiors and return the
+    * \f$\max\f$-norm of the new destination, reading each patch once.
+    * This gives the same result as scale() followed by maxNorm().  If
+    * the control volume is undefined (vol_id < 0), it is ignored during
+    * the computation of the maximum.  If local_only is true, the global
+    * reduction is not performed.
+    *
+    * @pre getPatchHierarchy()
+    * @pre (d_coarsest_level >= 0) && (d_finest_level >= d_coarsest_level) &&
+    *      (d_finest_level <= getPatchHierarchy()->getFinestLevelNumber())
+    */
+   double
+   scaleAndMaxNorm(
+      const int dst_id,
+      const TYPE& alpha,
+      const int src_id,
+      const int vol_id = -1,
+      bool local_only = false) const;
+
    /**
     * Return the integral of the function represented by the data array.
     * The return value is the sum \f$\sum_i ( data_i * vol_i )\f$.
@@ -223,6 +223,81 @@ public:
       const std::shared_ptr<pdat::FaceData<double> >& cvol =
          std::shared_ptr<pdat::FaceData<double> >()) const;
 
+   /**
+    * Set \f$d = \alpha s_1 + \beta s_2\f$ and return the dot product of
+    * the new destination with the data using the control volume, in a
+    * single pass over the data.  That is, the return value is the sum
+    * \f$\sum_i ( d_i * data_i * cvol_i )\f$.  If the control volume is
+    * NULL, it is ignored.  Otherwise only the part of the box covered by
+    * the control volume is updated.  The data may be the destination.
+    *
+    * @pre dst && src1 && src2 && data
+    * @pre (dst->getDim() == src1->getDim()) &&
+    *      (dst->getDim() == src2->getDim()) &&
+    *      (dst->getDim() == data->getDim()) &&
+    *      (dst->getDim() == box.getDim())
+    * @pre !cvol || (dst->getDim() == cvol->getDim())
+    */
+   TYPE
+   linearSumAndDot(
+      const std::shared_ptr<pdat::FaceData<TYPE> >& dst,
+      const TYPE& alpha,
+      const std::shared_ptr<pdat::FaceData<TYPE> >& src1,
+      const TYPE& beta,
+      const std::shared_ptr<pdat::FaceData<TYPE> >& src2,
+      const std::shared_ptr<pdat::FaceData<TYPE> >& data,
+      const hier::Box& box,
+      const std::shared_ptr<pdat::FaceData<double> >& cvol =
+         std::shared_ptr<pdat::FaceData<double> >()) const;
+
+   /**
+    * Set \f$d = \alpha s_1 + \beta s_2\f$ and return the weighted
+    * \f$L_2\f$-norm of the new destination using the control volume, in a
+    * single pass over the data.  That is, the return value is
+    * \f$\sqrt{ \sum_i ( (d_i * weight_i)^2 cvol_i ) }\f$.  If the control
+    * volume is NULL, it is ignored.  Otherwise only the part of the box
+    * covered by the control volume is updated.
+    *
+    * @pre dst && src1 && src2 && weight
+    * @pre (dst->getDim() == src1->getDim()) &&
+    *      (dst->getDim() == src2->getDim()) &&
+    *      (dst->getDim() == weight->getDim()) &&
+    *      (dst->getDim() == box.getDim())
+    * @pre !cvol || (dst->getDim() == cvol->getDim())
+    */
+   double
+   linearSumAndWeightedL2Norm(
+      const std::shared_ptr<pdat::FaceData<TYPE> >& dst,
+      const TYPE& alpha,
+      const std::shared_ptr<pdat::FaceData<TYPE> >& src1,
+      const TYPE& beta,
+      const std::shared_ptr<pdat::FaceData<TYPE> >& src2,
+      const std::shared_ptr<pdat::FaceData<TYPE> >& weight,
+      const hier::Box& box,
+      const std::shared_ptr<pdat::FaceData<double> >& cvol =
+         std::shared_ptr<pdat::FaceData<double> >()) const;
+
+   /**
+    * Set \f$d = \alpha s\f$ and return the \f$\max\f$-norm of the new
+    * destination over the elements where \f$cvol_i > 0\f$, in a single
+    * pass over the data.  If the control volume is NULL, it is ignored.
+    * Otherwise only the part of the box covered by the control volume is
+    * updated.
+    *
+    * @pre dst && src
+    * @pre (dst->getDim() == src->getDim()) &&
+    *      (dst->getDim() == box.getDim())
+    * @pre !cvol || (dst->getDim() == cvol->getDim())
+    */
+   double
+   scaleAndMaxNorm(
+      const std::shared_ptr<pdat::FaceData<TYPE> >& dst,
+      const TYPE& alpha,
+      const std::shared_ptr<pdat::FaceData<TYPE> >& src,
+      const hier::Box& box,
+      const std::shared_ptr<pdat::FaceData<double> >& cvol =
+         std::shared_ptr<pdat::FaceData<double> >()) const;
+
    /**
     * Return the integral of the function represented by the data array.
     * The return value is the sum \f$\sum_i ( data_i * vol_i )\f$.
@@ -16,6 +16,7 @@
 #include "SAMRAI/hier/BaseGridGeometry.h"
 #include "SAMRAI/hier/Connector.h"
 #include "SAMRAI/hier/MappingConnector.h"
+#include "SAMRAI/hier/PatchHierarchy.h"
 #include "SAMRAI/hier/PatchLevel.h"
 #include "SAMRAI/hier/ProcessorMapping.h"
 #include "SAMRAI/math/PatchCellDataNormOpsReal.h"
@@ -25,6 +26,8 @@
 
 #include <iostream>
 #include <list>
+#include <memory>
+#include <string>
 #include <vector>
 
 namespace SAMRAI {
@@ -456,8 +459,74 @@ struct BalanceUtilities {
       const tbox::SAMRAI_MPI& mpi,
       std::ostream& output_stream = tbox::plog);
 
+   /*!
+    * @brief Globally reduce a sequence of edge cuts in an MPI group
+    * and write out a summary.
+    *
+    * Each value in the sequences represents the edge cut of the local
+    * process at a point in a sequence of partitionings, as computed
+    * by computeEdgeCut().  For example, before and after a load
+    * balancing.
+    *
+    * To be used for performance evaluation.  Not recommended for
+    * general use.
+    *
+    * @param[in] local_cut_areas Sequence of cut face areas of the
+    * local process.
+    *
+    * @param[in] local_peer_counts Sequence of peer counts of the local
+    * process.  Must have the same size as @c local_cut_areas.
+    *
+    * @param[in] mpi Represents all processes involved in the load balancing.
+    *
+    * @param[in] output_stream
+    */
+   static void
+   reduceAndReportEdgeCut(
+      const std::vector<double>& local_cut_areas,
+      const std::vector<int>& local_peer_counts,
+      const tbox::SAMRAI_MPI& mpi,
+      std::ostream& output_stream = tbox::plog);
+
    //@}
 
+   /*!
+    * @brief Return the number of cells of face shared by two boxes.
+    *
+    * Boxes share face cells where they touch across a cell face.
+    * Boxes in different blocks, or that only touch at edges or
+    * corners, share none.
+    *
+    * @param[in] box_a
+    * @param[in] box_b
+    */
+   static double
+   computeSharedFaceArea(
+      const hier::Box& box_a,
+      const hier::Box& box_b);
+
+   /*!
+    * @brief Compute the edge cut of the local boxes of a BoxLevel.
+    *
+    * The edge cut estimates the ghost data exchanged with other
+    * processes: the cut face area is the number of cells of face the
+    * local boxes share with boxes owned by other processes, and the
+    * peer count is the number of those processes.
+    *
+    * This method is collective over the BoxLevel's SAMRAI_MPI.  It
+    * finds face neighbors with an assumed-partition search, so it
+    * does not globalize the BoxLevel.
+    *
+    * @param[out] cut_face_area
+    * @param[out] num_peers
+    * @param[in] box_level Should not have periodic images.
+    */
+   static void
+   computeEdgeCut(
+      double& cut_face_area,
+      int& num_peers,
+      const hier::BoxLevel& box_level);
+
    /*
     * Constrain maximum box sizes in the given BoxLevel and
     * update given Connectors to the changed BoxLevel.
@@ -470,6 +539,89 @@ struct BalanceUtilities {
       hier::Connector* anchor_to_level,
       const PartitioningParams& pparams);
 
+   /*!
+    * @brief Record a workload patch data index in a load balancer's
+    * per-level table.
+    *
+    * If level_number is non-negative, data_id is used for that level
+    * and any entries added below it get master_data_id.  If
+    * level_number is negative, data_id becomes master_data_id and
+    * replaces every entry in the table.
+    *
+    * @param[in,out] level_data_ids Per-level workload data ids
+    * @param[in,out] master_data_id Workload data id for levels without
+    *                               their own entry
+    * @param[in] data_id
+    * @param[in] level_number
+    *
+    * @pre hier::VariableDatabase::getDatabase()->getPatchDescriptor()->getPatchDataFactory(data_id) is actually a  std::shared_ptr<pdat::CellDataFactory<double> >
+    */
+   static void
+   setWorkloadDataId(
+      std::vector<int>& level_data_ids,
+      int& master_data_id,
+      int data_id,
+      int level_number);
+
+   /*!
+    * @brief Return the least common multiple of a cut factor and a
+    * tile size, for each block.
+    *
+    * @param[in] cut_factor Single or per-block cut factor
+    * @param[in] tile_size
+    * @param[in] nblocks
+    */
+   static hier::IntVector
+   computeEffectiveCutFactor(
+      const hier::IntVector& cut_factor,
+      const hier::IntVector& tile_size,
+      size_t nblocks);
+
+   /*!
+    * @brief Create a PatchLevel on the boxes being balanced and fill
+    * its workload data from the hierarchy's current level.
+    *
+    * The new level's Connectors to the reference level are copies of
+    * balance_to_reference and its transpose.  They are bridged with
+    * the current level's Connectors to the reference level so the
+    * workload data can be refined onto the new level.
+    *
+    * @param[in] balance_box_level
+    * @param[in] balance_to_reference
+    * @param[in] hierarchy
+    * @param[in] level_number Level being balanced.  It must exist in
+    *                         hierarchy.
+    * @param[in] workload_data_id
+    *
+    * @pre balance_to_reference.hasTranspose()
+    * @pre hierarchy->getNumberOfLevels() > level_number
+    */
+   static std::shared_ptr<hier::PatchLevel>
+   createWorkloadLevel(
+      const hier::BoxLevel& balance_box_level,
+      const hier::Connector& balance_to_reference,
+      const std::shared_ptr<hier::PatchHierarchy>& hierarchy,
+      int level_number,
+      int workload_data_id);
+
+   /*!
+    * @brief Check the overlap and transpose correctness of the
+    * Connectors between balanced and reference levels.
+    *
+    * Errors are reported to tbox::perr and are fatal.
+    *
+    * @param[in] balance_box_level
+    * @param[in] balance_to_reference
+    * @param[in] caller Name written to the log
+    *
+    * @pre balance_to_reference.hasTranspose()
+    */
+   static void
+   checkBalanceConnectivity(
+      const hier::BoxLevel& balance_box_level,
+      const hier::Connector& balance_to_reference,
+      const std::string& caller);
+
    static const int BalanceUtilities_PREBALANCE0 = 5;
    static const int BalanceUtilities_PREBALANCE1 = 6;
 
@@ -18,6 +18,7 @@
 #include "SAMRAI/hier/BoxLevel.h"
 #include "SAMRAI/hier/Connector.h"
 #include "SAMRAI/hier/PatchLevel.h"
+#include "SAMRAI/pdat/CellData.h"
 
 #include <set>
 #include <list>
@@ -357,6 +358,16 @@ private:
    void
    computeGlobalTagDependentVariables();
 
+   //! @brief Add the tags of tag_data in region to histogram.
+   static void
+   accumulateTagHistogram(
+      VectorOfInts& histogram,
+      const VectorOfInts& hist_offsets,
+      const hier::Box& hist_box,
+      const pdat::CellData<int>& tag_data,
+      const hier::Box& region,
+      const int tag_val);
+
    bool
    findZeroCutSwath(
       int& cut_lo,
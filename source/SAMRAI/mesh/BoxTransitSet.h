@@ -24,6 +24,7 @@
 #include "SAMRAI/tbox/MessageStream.h"
 #include "SAMRAI/tbox/StartupShutdownManager.h"
 
+#include <map>
 #include <set>
 
 namespace SAMRAI {
@@ -430,6 +431,77 @@ private:
       LoadType low_load,
       LoadType high_load);
 
+   /*!
+    * @brief Face area each box in a source bin would cut by moving
+    * to the destination bin, keyed by the box's address in the source.
+    */
+   typedef std::map<const BoxInTransit *, double> CutAreaMap;
+
+   /*!
+    * @brief Choose the box to pop from a source bin when communication
+    * is weighed along with balance.
+    *
+    * Of the boxes whose move would improve the destination's load, return
+    * the one with the lowest sum of balance penalty and
+    * communication penalty.  The communication penalty is
+    * PartitioningParams::getCommunicationWeight() times the box's
+    * entry in @c cut_areas: the face area the box shares with the rest
+    * of @c src minus the face area it shares with @c dst, which
+    * estimates the cut created by moving it.  Preferring boxes that
+    * touch @c dst keeps each shipment contiguous, which also tends to
+    * limit the number of peers.
+    *
+    * The cost is linear in the number of boxes in @c src.
+    *
+    * @return Iterator to the chosen box, or src.begin() if no box
+    * improves the destination's load.
+    *
+    * @see computeCutAreas(), updateCutAreas()
+    */
+   iterator
+   findCommunicationAwarePop(
+      BoxTransitSet& src,
+      const BoxTransitSet& dst,
+      const CutAreaMap& cut_areas,
+      LoadType dst_ideal_load,
+      LoadType dst_low_load,
+      LoadType dst_high_load) const;
+
+   /*!
+    * @brief Compute the cut area of each box in @c src for
+    * findCommunicationAwarePop().
+    *
+    * The cost is quadratic in the number of boxes in the bins, so it
+    * is done once per adjustLoadByPopping() call.
+    */
+   static void
+   computeCutAreas(
+      CutAreaMap& cut_areas,
+      const BoxTransitSet& src,
+      const BoxTransitSet& dst);
+
+   /*!
+    * @brief Update the cut areas of the boxes in @c src for a box
+    * about to be moved from @c src to the destination bin.
+    *
+    * Faces the remaining boxes share with @c popped change from
+    * uncut to cut, so this is linear in the number of boxes in @c src.
+    */
+   static void
+   updateCutAreas(
+      CutAreaMap& cut_areas,
+      const BoxTransitSet& src,
+      const BoxInTransit& popped);
+
+   /*!
+    * @brief Return the face area a box shares with the boxes in a
+    * BoxTransitSet.
+    */
+   static double
+   computeSharedFaceArea(
+      const hier::Box& box,
+      const BoxTransitSet& bin);
+
    /*!
     * @brief Adjust the load in this BoxTransitSet by swapping boxes
     * between it and another BoxTransitSet.
@@ -73,6 +73,14 @@ namespace mesh {
  *   alleviating the bottle-neck of one process doing an excessive amount
  *   of Connector updates.
  *
+ *   - \b communication_weight
+ *   Load equivalent of one cell of face shared by boxes on different
+ *   processes.  When positive, boxes given to other processes are
+ *   chosen to limit the face area cut and to keep each shipment
+ *   contiguous, at the cost of balance.  Use when ghost data exchange
+ *   limits scaling more than compute imbalance.  Choosing boxes is
+ *   quadratic in the number of local boxes.  Zero chooses by load only.
+ *
  *   - \b use_vouchers
  *   Boolean parameter to turn on the optional voucher method for passing
  *   around workload during the cascade algorithm.  Note that non-uniform
@@ -114,6 +122,14 @@ namespace mesh {
  *     <td>Not written to restart. Value in input db used.</td>
  *   </tr>
  *   <tr>
+ *     <td>communication_weight</td>
+ *     <td>double</td>
+ *     <td>0.0</td>
+ *     <td> >= 0</td>
+ *     <td>opt</td>
+ *     <td>Not written to restart. Value in input db used.</td>
+ *   </tr>
+ *   <tr>
  *     <td>use_vouchers</td>
  *     <td>bool</td>
  *     <td>FALSE</td>
@@ -130,6 +146,12 @@ namespace mesh {
  * bool
  * Whether to reset load obligations within groups that cannot change its load average.
  *
+ * @internal DEV_report_edge_cut (false)
+ * bool
+ * Whether to write the face area cut between processes and the number
+ * of peer processes before and after each load balancing to the log.
+ * Finding the cut takes an extra collective overlap search.
+ *
  * @internal DEV_limit_supply_to_surplus (true)
  * bool
  * Whether limit work a process can supply to its surplus.  The effects on partitioning
@@ -429,6 +451,11 @@ private:
     */
    bool d_limit_supply_to_surplus;
 
+   /*!
+    * @brief See "communication_weight" input parameter.
+    */
+   double d_communication_weight;
+
    /*!
     * @brief Whether to reset load obligations within groups that
     * cannot change its load average.
@@ -498,6 +525,12 @@ private:
     */
    bool d_report_load_balance;
 
+   /*!
+    * @brief Whether to report the edge cut before and after load
+    * balancing in the log files.
+    */
+   bool d_report_edge_cut;
+
    /*!
     * @brief See "summarize_map" input parameter.
     */
@@ -89,6 +89,15 @@ public:
       d_using_vouchers = using_vouchers;
    }
 
+   const double& getCommunicationWeight() const {
+      return d_communication_weight;
+   }
+
+   void setCommunicationWeight(double communication_weight) {
+      TBOX_ASSERT(communication_weight >= 0.0);
+      d_communication_weight = communication_weight;
+   }
+
    const int& getWorkloadDataId() const {
       return d_work_data_id;
    }
@@ -145,6 +154,12 @@ private:
     */
    bool d_using_vouchers;
 
+   /*!
+    * @brief Load equivalent of one cell of face between boxes on
+    * different processes.  Zero means boxes are chosen by load only.
+    */
+   double d_communication_weight;
+
    /*!
     * @brief Patch data id for nonuniform workload
     */
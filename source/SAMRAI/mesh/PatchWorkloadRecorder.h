@@ -0,0 +1,294 @@
+/*************************************************************************
+ *
+ * This file is part of the SAMRAI distribution.  For full copyright
+ * information, see COPYRIGHT and LICENSE.
+ *
+ * Copyright:     (c) 1997-2020 Lawrence Livermore National Security, LLC
+ * Description:   Measured per-patch cost used as load balancing workload.
+ *
+ ************************************************************************/
+
+#ifndef included_mesh_PatchWorkloadRecorder
+#define included_mesh_PatchWorkloadRecorder
+
+#include "SAMRAI/SAMRAI_config.h"
+#include "SAMRAI/hier/BoxId.h"
+#include "SAMRAI/hier/Patch.h"
+#include "SAMRAI/hier/PatchLevel.h"
+#include "SAMRAI/mesh/LoadBalanceStrategy.h"
+#include "SAMRAI/pdat/CellVariable.h"
+#include "SAMRAI/tbox/Database.h"
+#include "SAMRAI/tbox/Dimension.h"
+#include "SAMRAI/tbox/SAMRAI_MPI.h"
+#include "SAMRAI/tbox/Timer.h"
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace SAMRAI {
+namespace mesh {
+
+/*!
+ * @brief Times the work done on each patch and keeps a smoothed
+ * per-cell cost in cell-centered workload data that load balancers
+ * can use for non-uniform load balancing.
+ *
+ * Integrators call startPatch() and stopPatch() around the numerical
+ * work on each patch, then updateLevel() once the patches of a level
+ * are done.  updateLevel() spreads each patch's measured time evenly
+ * over its cells, normalizes it by the mean cost per cell of the
+ * level, and blends it into the workload data with exponential
+ * smoothing:
+ *
+ * @verbatim
+ *    workload = smoothing_factor * measured + (1 - smoothing_factor) * workload
+ * @endverbatim
+ *
+ * A workload of 1 is the level's average cost per cell.  When a
+ * level is regridded, cells of the new level take the smoothed
+ * workload of the level it replaces where the two overlap.  Other
+ * cells, and all cells of newly created levels, start at 1, so they
+ * are balanced by cell count until their patches have been timed.
+ *
+ * To use the measured cost, give the workload patch data index to the
+ * load balancer, for example with registerWithLoadBalancer(), and set
+ * the recorder on the integrator, e.g.
+ * algs::HyperbolicLevelIntegrator::setPatchWorkloadRecorder().
+ * The integrator carries the workload over to regridded levels
+ * through initializeLevelData() and allocates it on every level of
+ * the hierarchy through initializeLevel().
+ *
+ * Timing uses wall clock time, so the cost includes any other activity
+ * on the process.  The resulting partitions are not reproducible from
+ * run to run.
+ *
+ * <b> Input Parameters </b>
+ *
+ * <b> Definitions: </b>
+ *
+ *   - \b smoothing_factor
+ *   Weight of the newest measurement in the smoothed workload.  1 uses
+ *   only the latest measurement.  Smaller values damp timing noise but
+ *   respond more slowly to changes in cost.
+ *
+ * <b> Details: </b> <br>
+ * <table>
+ *   <tr>
+ *     <th>parameter</th>
+ *     <th>type</th>
+ *     <th>default</th>
+ *     <th>range</th>
+ *     <th>opt/req</th>
+ *     <th>behavior on restart</th>
+ *   </tr>
+ *   <tr>
+ *     <td>smoothing_factor</td>
+ *     <td>double</td>
+ *     <td>0.5</td>
+ *     <td>(0, 1]</td>
+ *     <td>opt</td>
+ *     <td>Not written to restart. Value in input db used.</td>
+ *   </tr>
+ * </table>
+ *
+ * The workload data is not written to restart.  After a restart, every
+ * level starts again at a workload of 1.
+ *
+ * @see LoadBalanceStrategy::setWorkloadPatchDataIndex()
+ */
+
+class PatchWorkloadRecorder
+{
+public:
+   /*!
+    * @brief Construct the recorder and register its workload variable.
+    *
+    * @param[in] dim
+    * @param[in] object_name Name of object, used to name the workload
+    * variable.
+    * @param[in] input_db Input parameters.  May be null.
+    *
+    * @pre !object_name.empty()
+    */
+   PatchWorkloadRecorder(
+      const tbox::Dimension& dim,
+      const std::string& object_name,
+      const std::shared_ptr<tbox::Database>& input_db =
+         std::shared_ptr<tbox::Database>());
+
+   /*!
+    * @brief Destructor.
+    */
+   ~PatchWorkloadRecorder();
+
+   /*!
+    * @brief Return the patch data index of the cell-centered workload.
+    */
+   int
+   getWorkloadPatchDataIndex() const
+   {
+      return d_workload_data_id;
+   }
+
+   /*!
+    * @brief Tell a load balancer to use the workload on all levels.
+    *
+    * @param[in,out] load_balancer
+    */
+   void
+   registerWithLoadBalancer(
+      LoadBalanceStrategy& load_balancer) const
+   {
+      load_balancer.setWorkloadPatchDataIndex(d_workload_data_id);
+   }
+
+   /*!
+    * @brief Allocate the workload data on a new level and copy the
+    * smoothed workload from the level it replaces.
+    *
+    * Cells not covered by old_level, or all cells if old_level is null
+    * or has no workload data, are set to 1.  Integrators call this from
+    * StandardTagAndInitStrategy::initializeLevelData().  This method is
+    * collective over the level's SAMRAI_MPI.
+    *
+    * @param[in,out] level
+    * @param[in] old_level Level being replaced.  May be null.
+    *
+    * @pre !old_level || old_level->getLevelNumber() == level->getLevelNumber()
+    */
+   void
+   initializeLevelData(
+      const std::shared_ptr<hier::PatchLevel>& level,
+      const std::shared_ptr<hier::PatchLevel>& old_level);
+
+   /*!
+    * @brief Allocate the workload data on a level and set it to 1,
+    * unless it is already allocated.
+    *
+    * Measurements pending for the level are discarded, because they
+    * refer to patches of the level it replaced.
+    *
+    * @param[in,out] level
+    */
+   void
+   initializeLevel(
+      hier::PatchLevel& level);
+
+   /*!
+    * @brief Start timing work on a patch.
+    */
+   void
+   startPatch()
+   {
+      d_start_time = tbox::SAMRAI_MPI::Wtime();
+   }
+
+   /*!
+    * @brief Stop timing work on a patch and add the elapsed time since
+    * the last startPatch() to the patch's pending measurement.
+    *
+    * A patch may be timed several times, for example once per
+    * Runge-Kutta stage, before its level is updated.
+    *
+    * @param[in] patch
+    */
+   void
+   stopPatch(
+      const hier::Patch& patch);
+
+   /*!
+    * @brief Add a measured time to a patch's pending measurement.
+    *
+    * This is what stopPatch() does with the elapsed time.  It lets
+    * callers that time the patch work themselves record the cost.
+    *
+    * @param[in] patch
+    * @param[in] seconds
+    *
+    * @pre seconds >= 0.0
+    */
+   void
+   recordPatchTime(
+      const hier::Patch& patch,
+      double seconds);
+
+   /*!
+    * @brief Blend the pending measurements for a level into its
+    * workload data and clear them.
+    *
+    * Patches without a pending measurement keep their workload.  This
+    * method is collective over the level's SAMRAI_MPI.
+    *
+    * @param[in,out] level
+    *
+    * @pre level.getLevelNumber() >= 0
+    */
+   void
+   updateLevel(
+      hier::PatchLevel& level);
+
+   /*!
+    * @brief Return the object name.
+    */
+   const std::string&
+   getObjectName() const
+   {
+      return d_object_name;
+   }
+
+private:
+   // The following are not implemented:
+   PatchWorkloadRecorder(
+      const PatchWorkloadRecorder&);
+
+   PatchWorkloadRecorder&
+   operator = (
+      const PatchWorkloadRecorder&);
+
+   /*!
+    * @brief Allocate the workload data on a level and set it to 1,
+    * unless it is already allocated.
+    */
+   void
+   allocateWorkload(
+      hier::PatchLevel& level) const;
+
+   /*!
+    * @brief Read parameters from input database.
+    *
+    * @param input_db Input Database.
+    */
+   void
+   getFromInput(
+      const std::shared_ptr<tbox::Database>& input_db);
+
+   const tbox::Dimension d_dim;
+
+   std::string d_object_name;
+
+   std::shared_ptr<pdat::CellVariable<double> > d_workload_variable;
+
+   int d_workload_data_id;
+
+   //! @brief Weight of the newest measurement.
+   double d_smoothing_factor;
+
+   //! @brief Time at the last startPatch().
+   double d_start_time;
+
+   /*!
+    * @brief Pending measured seconds of each patch, indexed by level
+    * number.
+    */
+   std::vector<std::map<hier::BoxId, double> > d_patch_time;
+
+   std::shared_ptr<tbox::Timer> t_update_level;
+
+};
+
+}
+}
+
+#endif
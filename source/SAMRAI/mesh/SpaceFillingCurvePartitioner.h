@@ -0,0 +1,620 @@
+/*************************************************************************
+ *
+ * This file is part of the SAMRAI distribution.  For full copyright
+ * information, see COPYRIGHT and LICENSE.
+ *
+ * Copyright:     (c) 1997-2020 Lawrence Livermore National Security, LLC
+ * Description:   Load balancer partitioning along a space-filling curve.
+ *
+ ************************************************************************/
+
+#ifndef included_mesh_SpaceFillingCurvePartitioner
+#define included_mesh_SpaceFillingCurvePartitioner
+
+#include "SAMRAI/SAMRAI_config.h"
+#include "SAMRAI/hier/MappingConnectorAlgorithm.h"
+#include "SAMRAI/mesh/BoxInTransit.h"
+#include "SAMRAI/mesh/LoadBalanceStrategy.h"
+#include "SAMRAI/mesh/PartitioningParams.h"
+#include "SAMRAI/mesh/SpatialKey.h"
+#include "SAMRAI/tbox/Database.h"
+#include "SAMRAI/tbox/SAMRAI_MPI.h"
+#include "SAMRAI/tbox/RankGroup.h"
+#include "SAMRAI/tbox/Timer.h"
+#include "SAMRAI/tbox/Utilities.h"
+
+#include <iostream>
+#include <vector>
+#include <memory>
+
+namespace SAMRAI {
+namespace mesh {
+
+/*!
+ * @brief Provides load balancing routines for AMR hierarchy by
+ * implementing the LoadBalancerStrategy using a space-filling curve.
+ *
+ * The boxes of the level are ordered along a Hilbert or Morton curve,
+ * using SpatialKey for the ordering, and the curve is cut into
+ * contiguous pieces of equal load, one piece per process.  A box
+ * straddling a cut is broken at the cut, subject to the minimum size,
+ * cut factor and bad interval constraints.  Because neighboring boxes
+ * tend to be near each other on the curve, each process gets a compact
+ * region and has few neighbor processes.
+ *
+ * The ordering is computed with a distributed sample sort.  Each
+ * process contributes a few load-weighted samples of its boxes' curve
+ * positions, the gathered samples determine curve intervals of nearly
+ * equal load, and the boxes are sent to the processes owning their
+ * intervals.  After a prefix sum of the sorted loads, each process
+ * knows where its boxes lie on the curve and sends them to their final
+ * owners.  Because the sample intervals approximate the final
+ * partition, most boxes do not move in the second step.  The
+ * unbalanced<==>balanced mappings are then generated as in the other
+ * partitioners.
+ *
+ * This class can be used for both uniform or non-uniform load balancing.
+ * To enable non-uniform load balancing, a call must be made to the method
+ * setWorkloadPatchDataIndex to give this object a patch data id for
+ * cell-centered workload data that must be set on the hierarchy outside of
+ * this class.  When a box is broken at a cut, its load is divided in
+ * proportion to the cells on each side.
+ *
+ * The default behavior of this class is to do uniform load balancing, treating
+ * all cells of a level as having equal load value.
+ *
+ * <b> Input Parameters </b>
+ *
+ * <b> Definitions: </b>
+ *
+ *   - \b curve
+ *   The space-filling curve to order the boxes along, either "HILBERT"
+ *   or "MORTON".  The Hilbert curve has no jumps, so it usually gives
+ *   more compact partitions.
+ *
+ *   - \b flexible_load_tolerance
+ *   Fraction of ideal load a process can
+ *   take on in order to reduce box cutting.  A box straddling a cut on
+ *   the curve is broken only if both of its sides would carry more than
+ *   this fraction of the ideal load.  Otherwise it goes whole to the
+ *   process holding most of it.
+ *
+ *   - \b tile_size
+ *   Tile size when using tile mode.  Tile mode restricts box cuts
+ *   to tile boundaries.  Default is 1, which is equivalent to no restriction.
+ *
+ * <b> Details: </b> <br>
+ * <table>
+ *   <tr>
+ *     <th>parameter</th>
+ *     <th>type</th>
+ *     <th>default</th>
+ *     <th>range</th>
+ *     <th>opt/req</th>
+ *     <th>behavior on restart</th>
+ *   </tr>
+ *   <tr>
+ *     <td>curve</td>
+ *     <td>string</td>
+ *     <td>"HILBERT"</td>
+ *     <td>"HILBERT", "MORTON"</td>
+ *     <td>opt</td>
+ *     <td>Not written to restart. Value in input db used.</td>
+ *   </tr>
+ *   <tr>
+ *     <td>flexible_load_tolerance</td>
+ *     <td>double</td>
+ *     <td>0.05</td>
+ *     <td>0-1</td>
+ *     <td>opt</td>
+ *     <td>Not written to restart. Value in input db used.</td>
+ *   </tr>
+ *   <tr>
+ *     <td>tile_size</td>
+ *     <td>IntVector</td>
+ *     <td>1</td>
+ *     <td>1-</td>
+ *     <td>opt</td>
+ *     <td>Not written to restart. Value in input db used.</td>
+ *   </tr>
+ * </table>
+ *
+ * @internal The following are developer inputs.  Defaults listed
+ * in parenthesis:
+ *
+ * @internal DEV_samples_per_proc (8)
+ * int
+ * Number of load-weighted samples each process contributes to the
+ * sample sort.  More samples make the intervals of the sort closer to
+ * the final partition at the cost of a larger all-gather.
+ *
+ * @see LoadBalanceStrategy
+ */
+
+class SpaceFillingCurvePartitioner:
+   public LoadBalanceStrategy
+{
+public:
+   /*!
+    * @brief Initializing constructor sets object state to default or,
+    * if database provided, to parameters in database.
+    *
+    * @param[in] dim
+    *
+    * @param[in] name User-defined identifier used for error reporting
+    * and timer names.
+    *
+    * @param[in] input_db (optional) database pointer providing
+    * parameters from input file.  This pointer may be null indicating
+    * no input is used.
+    *
+    * @pre !name.empty()
+    */
+   SpaceFillingCurvePartitioner(
+      const tbox::Dimension& dim,
+      const std::string& name,
+      const std::shared_ptr<tbox::Database>& input_db =
+         std::shared_ptr<tbox::Database>());
+
+   /*!
+    * @brief Virtual destructor releases all internal storage.
+    */
+   virtual ~SpaceFillingCurvePartitioner();
+
+   /*!
+    * @brief Set the internal SAMRAI_MPI to a duplicate of the given
+    * SAMRAI_MPI.
+    *
+    * The given SAMRAI_MPI must have a valid communicator.
+    *
+    * The given SAMRAI_MPI is duplicated for private use.  This
+    * requires a global communication, so all processes in the
+    * communicator must call it.  The advantage of a duplicate
+    * communicator is that it ensures the communications for the
+    * object won't accidentally interact with unrelated
+    * communications.
+    *
+    * If the duplicate SAMRAI_MPI it is set, the
+    * SpaceFillingCurvePartitioner will only balance BoxLevels with
+    * congruent SAMRAI_MPI objects and will use the duplicate SAMRAI_MPI
+    * for communications.  Otherwise, the SAMRAI_MPI of the BoxLevel
+    * will be used.  The duplicate MPI communicator is freed when the
+    * object is destructed, or freeMPICommunicator() is called.
+    *
+    * @pre samrai_mpi.getCommunicator() != tbox::SAMRAI_MPI::commNull
+    */
+   void
+   setSAMRAI_MPI(
+      const tbox::SAMRAI_MPI& samrai_mpi);
+
+   /*!
+    * @brief Free the internal MPI communicator, if any has been set.
+    *
+    * This is automatically done by the destructor, if needed.
+    *
+    * @see setSAMRAI_MPI().
+    */
+   void
+   freeMPICommunicator();
+
+   /*!
+    * @copydoc LoadBalanceStrategy::loadBalanceBoxLevel()
+    *
+    * @pre !balance_to_anchor || balance_to_anchor->hasTranspose()
+    * @pre !balance_to_anchor || balance_to_anchor->isTransposeOf(balance_to_anchor->getTranspose())
+    * @pre (d_dim == balance_box_level.getDim()) &&
+    *      (d_dim == min_size.getDim()) && (d_dim == max_size.getDim()) &&
+    *      (d_dim == domain_box_level.getDim()) &&
+    *      (d_dim == bad_interval.getDim()) && (d_dim == cut_factor.getDim())
+    * @pre !hierarchy || (d_dim == hierarchy->getDim())
+    * @pre !d_mpi_is_dupe || (d_mpi.getSize() == balance_box_level.getMPI().getSize())
+    * @pre !d_mpi_is_dupe || (d_mpi.getSize() == balance_box_level.getMPI().getRank())
+    */
+   void
+   loadBalanceBoxLevel(
+      hier::BoxLevel& balance_box_level,
+      hier::Connector* balance_to_anchor,
+      const std::shared_ptr<hier::PatchHierarchy>& hierarchy,
+      const int level_number,
+      const hier::IntVector& min_size,
+      const hier::IntVector& max_size,
+      const hier::BoxLevel& domain_box_level,
+      const hier::IntVector& bad_interval,
+      const hier::IntVector& cut_factor,
+      const tbox::RankGroup& rank_group = tbox::RankGroup()) const;
+
+   /*!
+    * @brief Write out statistics recorded for the most recent load
+    * balancing result.
+    *
+    * @param[in] output_stream
+    */
+   void
+   printStatistics(
+      std::ostream& output_stream = tbox::plog) const;
+
+   /*!
+    * @brief Get the name of this object.
+    */
+   const std::string&
+   getObjectName() const
+   {
+      return d_object_name;
+   }
+
+   /*!
+    * @brief Configure the load balancer to use the data stored
+    * in the hierarchy at the specified descriptor index
+    * for estimating the workload on each cell.
+    *
+    * @param data_id
+    * Integer value of patch data identifier for workload
+    * estimate on each cell.  An invalid value (i.e., < 0)
+    * indicates that a spatially-uniform work estimate
+    * will be used.  The default value is -1 (undefined)
+    * implying the uniform work estimate.
+    *
+    * @param level_number
+    * Optional integer number for level on which data id
+    * is used.  If no value is given, the data will be
+    * used for all levels.
+    *
+    * @pre hier::VariableDatabase::getDatabase()->getPatchDescriptor()->getPatchDataFactory(data_id) is actually a  std::shared_ptr<pdat::CellDataFactory<double> >
+    */
+   void
+   setWorkloadPatchDataIndex(
+      int data_id,
+      int level_number = -1);
+
+   /*!
+    * @brief Return true if load balancing procedure for given level
+    * depends on patch data on mesh; otherwise return false.
+    *
+    * @param[in] level_number  Integer patch level number.
+    */
+   bool
+   getLoadBalanceDependsOnPatchData(
+      int level_number) const;
+
+private:
+   typedef double LoadType;
+
+   /*
+    * Static integer constants.  Tags are for isolating messages
+    * from different phases of the algorithm.
+    */
+   static const int SpaceFillingCurvePartitioner_SORTTAG = 7;
+   static const int SpaceFillingCurvePartitioner_SHIPTAG = 8;
+
+   //! @brief Curves the boxes may be ordered along.
+   enum CurveType { HILBERT = 0, MORTON = 1 };
+
+   /*!
+    * @brief A box in transit and its position on the curve.
+    */
+   struct CurveItem {
+      CurveItem(
+         const BoxInTransit& box_in_transit,
+         const SpatialKey& key):
+         d_box_in_transit(box_in_transit),
+         d_key(key) {
+      }
+      BoxInTransit d_box_in_transit;
+      SpatialKey d_key;
+   };
+
+   /*!
+    * @brief Orders CurveItems by BlockId, then by position on the
+    * curve, then by box for a reproducible order of coincident keys.
+    */
+   struct CurveItemLess {
+      bool operator () (
+         const CurveItem& a,
+         const CurveItem& b) const {
+         const hier::Box& abox = a.d_box_in_transit.getBox();
+         const hier::Box& bbox = b.d_box_in_transit.getBox();
+         if (abox.getBlockId() != bbox.getBlockId()) {
+            return abox.getBlockId() < bbox.getBlockId();
+         }
+         if (a.d_key != b.d_key) {
+            return a.d_key < b.d_key;
+         }
+         for (hier::Index::dir_t d = 0; d < abox.getDim().getValue(); ++d) {
+            if (abox.lower(d) != bbox.lower(d)) {
+               return abox.lower(d) < bbox.lower(d);
+            }
+         }
+         return a.d_box_in_transit.getOrigBox().getBoxId() <
+                b.d_box_in_transit.getOrigBox().getBoxId();
+      }
+   };
+
+   // The following are not implemented, but are provided here for
+   // dumb compilers.
+
+   SpaceFillingCurvePartitioner(
+      const SpaceFillingCurvePartitioner&);
+
+   void
+   operator = (
+      const SpaceFillingCurvePartitioner&);
+
+   /*
+    * @brief Check if there is any pending messages for the private
+    * communication and throw an error if there is.
+    */
+   void
+   assertNoMessageForPrivateCommunicator() const;
+
+   /*
+    * Read parameters from input database.
+    */
+   void
+   getFromInput(
+      const std::shared_ptr<tbox::Database>& input_db);
+
+   /*
+    * Utility functions to determine parameter values for level.
+    */
+   int
+   getWorkloadDataId(
+      int level_number) const
+   {
+      TBOX_ASSERT(level_number >= 0);
+      return level_number < static_cast<int>(d_workload_data_id.size()) ?
+             d_workload_data_id[level_number] :
+             d_master_workload_data_id;
+   }
+
+   /*
+    * Compute the load of a local box, from the workload data if
+    * d_workload_level is set and from the number of cells otherwise.
+    */
+   LoadType
+   computeLoad(
+      const hier::Box& box,
+      const hier::BoxId& patch_id) const;
+
+   /*
+    * Count the local workload.
+    */
+   LoadType
+   computeLocalLoad(
+      const hier::BoxLevel& box_level) const;
+
+   /*!
+    * @brief Implements the space-filling curve partitioning.
+    */
+   void
+   partitionAlongCurve(
+      hier::BoxLevel& balance_box_level,
+      hier::Connector* balance_to_reference,
+      const tbox::RankGroup& rank_group) const;
+
+   /*!
+    * @brief Break the local boxes into pieces whose loads do not
+    * exceed the ideal load and order them along the curve.
+    */
+   void
+   makeLocalCurveItems(
+      std::vector<CurveItem>& items,
+      const hier::BoxLevel& balance_box_level) const;
+
+   /*!
+    * @brief Sort the items across the processes of the RankGroup with a
+    * load-weighted sample sort.
+    *
+    * On return, items holds this process's interval of the curve, in
+    * curve order.
+    */
+   void
+   sortAlongCurve(
+      std::vector<CurveItem>& items,
+      const tbox::RankGroup& rank_group) const;
+
+   /*!
+    * @brief Assign the sorted items to group members by their
+    * positions on the curve, breaking items that straddle cuts.
+    *
+    * @param[in,out] items Sorted items.  Items straddling cuts are
+    * replaced by their pieces.
+    *
+    * @param[out] item_owners Index, in rank_group, of each item's owner.
+    */
+   void
+   assignAlongCurve(
+      std::vector<CurveItem>& items,
+      std::vector<int>& item_owners,
+      const tbox::RankGroup& rank_group) const;
+
+   /*!
+    * @brief Send items to group members.
+    *
+    * item_bins must be non-decreasing, so each process sends to a
+    * contiguous range of group members.  On return, items holds the
+    * items sent to the local process, in no particular order.
+    */
+   void
+   exchangeItems(
+      std::vector<CurveItem>& items,
+      const std::vector<int>& item_bins,
+      const tbox::RankGroup& rank_group,
+      int tag) const;
+
+   /*!
+    * @brief Compute the bounding box of the level in each block, for
+    * scaling the curve.
+    */
+   void
+   computeCurveDomain(
+      const hier::BoxLevel& balance_box_level) const;
+
+   /*!
+    * @brief Compute the curve position of a cell.
+    */
+   SpatialKey
+   computeCurveKey(
+      const hier::BlockId& block_id,
+      const hier::Index& cell) const;
+
+   /*!
+    * @brief Compute the curve position of a box's center cell.
+    */
+   SpatialKey
+   computeCurveKey(
+      const hier::Box& box) const;
+
+   /*!
+    * @brief Cut a box in its longest cuttable direction so that the
+    * lower piece has about the given fraction of the cells.
+    *
+    * @return Whether a cut satisfying the partitioning constraints
+    * was found.
+    */
+   bool
+   cutBox(
+      hier::Box& lower_piece,
+      hier::Box& upper_piece,
+      const hier::Box& box,
+      double fraction) const;
+
+   /*!
+    * @brief Convert coordinates to the transposed Hilbert index,
+    * following J. Skilling, "Programming the Hilbert curve", AIP Conf.
+    * Proc. 707 (2004).
+    *
+    * Interleaving the bits of the transposed coordinates, most
+    * significant first, gives the Hilbert index.
+    */
+   static void
+   hilbertTranspose(
+      unsigned int* coords,
+      int nbits,
+      int ndim);
+
+   /*!
+    * @brief Set up timers for the object.
+    */
+   void
+   setTimers();
+
+   /*
+    * Object dimension.
+    */
+   const tbox::Dimension d_dim;
+
+   /*
+    * String identifier for load balancer object.
+    */
+   std::string d_object_name;
+
+   //! @brief Duplicated communicator object.  See setSAMRAI_MPI().
+   mutable tbox::SAMRAI_MPI d_mpi;
+
+   //! @brief Whether d_mpi is an internal duplicate.  See setSAMRAI_MPI().
+   bool d_mpi_is_dupe;
+
+   /*
+    * Values for workload estimate data used on individual levels when
+    * specified as such.
+    */
+   std::vector<int> d_workload_data_id;
+
+   int d_master_workload_data_id;
+
+   /*!
+    * @brief Tile size, when restricting cuts to tile boundaries,
+    * Set to 1 when not restricting.
+    */
+   hier::IntVector d_tile_size;
+
+   /*!
+    * @brief Fraction of ideal load a process can accept over and above
+    * the ideal.
+    *
+    * See input parameter "flexible_load_tolerance".
+    */
+   double d_flexible_load_tol;
+
+   /*!
+    * @brief Curve to order the boxes along.
+    *
+    * See input parameter "curve".
+    */
+   CurveType d_curve_type;
+
+   /*!
+    * @brief Number of samples each process contributes to the sort.
+    *
+    * See input parameter "DEV_samples_per_proc".
+    */
+   int d_samples_per_proc;
+
+   /*!
+    * @brief Metadata operations with timers set according to this object.
+    */
+   hier::MappingConnectorAlgorithm d_mca;
+
+   /*!
+    * @brief Level holding workload data
+    */
+   mutable std::shared_ptr<hier::PatchLevel> d_workload_level;
+
+   //@{
+   //! @name Shared temporaries, used only when actively partitioning.
+   mutable std::shared_ptr<PartitioningParams> d_pparams;
+   mutable LoadType d_global_work_sum;
+   mutable LoadType d_global_work_avg;
+
+   //! @brief Bounding box of the level in each block, by block number.
+   mutable std::vector<hier::Box> d_curve_domain;
+
+   //! @brief Bits per coordinate of curve positions, by block number.
+   mutable std::vector<int> d_curve_bits;
+   //@}
+
+   static const int s_default_data_id;
+
+   //@{
+   //! @name Used for evaluating peformance.
+
+   /*!
+    * @brief Whether to immediately report the results of the load
+    * balancing cycles in the log files.
+    */
+   bool d_report_load_balance;
+
+   /*!
+    * @brief See "summarize_map" input parameter.
+    */
+   char d_summarize_map;
+
+   /*
+    * Performance timers.
+    */
+   std::shared_ptr<tbox::Timer> t_load_balance_box_level;
+   std::shared_ptr<tbox::Timer> t_compute_local_load;
+   std::shared_ptr<tbox::Timer> t_global_work_reduction;
+   std::shared_ptr<tbox::Timer> t_make_local_curve_items;
+   std::shared_ptr<tbox::Timer> t_sort_along_curve;
+   std::shared_ptr<tbox::Timer> t_assign_along_curve;
+   std::shared_ptr<tbox::Timer> t_exchange_items;
+   std::shared_ptr<tbox::Timer> t_assign_to_local_and_populate_maps;
+   std::shared_ptr<tbox::Timer> t_use_map;
+
+   //@}
+
+   // Extra checks independent of optimization/debug.
+   char d_print_steps;
+   char d_check_connectivity;
+   char d_check_map;
+
+   mutable std::vector<double> d_load_stat;
+   mutable std::vector<int> d_box_count_stat;
+
+};
+
+}
+}
+
+#endif
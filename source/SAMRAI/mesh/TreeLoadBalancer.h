@@ -68,6 +68,23 @@ namespace mesh {
  *   multiple cycles.  It alleviates the bottle-neck of one process having
  *   to work with too many other processes in any cycle.
  *
+ *   - \b incremental
+ *   Rebalance incrementally from the current owners instead of
+ *   recomputing the distribution.  Only processes with more than the
+ *   average load give up load, only their surplus is moved, and the
+ *   total moved is limited by migration_budget.  Imported load may be
+ *   passed on without counting against the budget.  Balancing is done
+ *   in one cycle, so max_spread_procs is not used.  This gives up some
+ *   balance for less data movement when regridding often.  The current
+ *   owners are those of the boxes given to the load balancer.  With
+ *   BergerRigoutsos's default owner mode, those are the processes
+ *   holding most of the tagged data.
+ *
+ *   - \b migration_budget
+ *   In incremental mode, the largest fraction of the global load that
+ *   may change owners in one load balancing.  When the total surplus
+ *   is larger, each process's export is reduced in proportion.
+ *
  * <b> Details: </b> <br>
  * <table>
  *   <tr>
@@ -102,6 +119,22 @@ namespace mesh {
  *     <td>opt</td>
  *     <td>Not written to restart. Value in input db used.</td>
  *   </tr>
+ *   <tr>
+ *     <td>incremental</td>
+ *     <td>bool</td>
+ *     <td>FALSE</td>
+ *     <td>TRUE or FALSE</td>
+ *     <td>opt</td>
+ *     <td>Not written to restart. Value in input db used.</td>
+ *   </tr>
+ *   <tr>
+ *     <td>migration_budget</td>
+ *     <td>double</td>
+ *     <td>1.0</td>
+ *     <td>0-1</td>
+ *     <td>opt</td>
+ *     <td>Not written to restart. Value in input db used.</td>
+ *   </tr>
  * </table>
  *
  * @internal The following are developer inputs.  Defaults listed
@@ -116,6 +149,12 @@ namespace mesh {
  * Whether to allow box-breaking.  Set to false when boxes have
  * been pre-cut.
  *
+ * @internal DEV_record_migration (false)
+ * bool
+ * Whether to record the cells and estimated bytes moved by each load
+ * balancing for printStatistics().  Migration is always recorded in
+ * incremental mode and when DEV_report_load_balance is set.
+ *
  * @see LoadBalanceStrategy
  */
 
@@ -712,6 +751,41 @@ private:
       tbox::AsyncCommPeer<char> *& child_comms,
       tbox::AsyncCommPeer<char> *& parent_comm) const;
 
+   /*!
+    * @brief Compute the load the local process may export in
+    * incremental mode and store it in d_migration_allowance.
+    *
+    * The allowance is the local surplus over the average load,
+    * scaled down if the global surplus is more than the migration
+    * budget.  All processes must call this method.
+    */
+   void
+   computeMigrationAllowance(
+      LoadType local_load,
+      LoadType global_sum_load) const;
+
+   /*!
+    * @brief Record the cells and estimated bytes of the initial local
+    * boxes that moved to other processes.
+    *
+    * Bytes are estimated from the patch data allocated on the level
+    * being replaced, if the hierarchy has it.  This searches the
+    * balanced boxes and does a global reduction, so it is called only
+    * in incremental mode or when DEV_report_load_balance or
+    * DEV_record_migration is set.  All processes must call this method.
+    *
+    * @param[in] initial_boxes Local boxes before balancing.
+    * @param[in] balanced_box_level
+    * @param[in] hierarchy
+    * @param[in] level_number
+    */
+   void
+   recordMigration(
+      const hier::BoxContainer& initial_boxes,
+      const hier::BoxLevel& balanced_box_level,
+      const std::shared_ptr<hier::PatchHierarchy>& hierarchy,
+      int level_number) const;
+
    /*!
     * @brief Set up timers for the object.
     */
@@ -773,6 +847,20 @@ private:
     */
    double d_flexible_load_tol;
 
+   /*!
+    * @brief Whether to rebalance incrementally.
+    *
+    * See input parameter "incremental".
+    */
+   bool d_incremental;
+
+   /*!
+    * @brief Fraction of global load allowed to move in incremental mode.
+    *
+    * See input parameter "migration_budget".
+    */
+   double d_migration_budget;
+
    /*!
     * @brief Metadata operations with timers set according to this object.
     */
@@ -783,6 +871,7 @@ private:
    mutable std::shared_ptr<PartitioningParams> d_pparams;
    mutable LoadType d_global_avg_load;
    mutable LoadType d_min_load;
+   mutable LoadType d_migration_allowance;
    //@}
 
    static const int s_default_data_id;
@@ -799,6 +888,11 @@ private:
     */
    bool d_report_load_balance;
 
+   /*!
+    * @brief See "DEV_record_migration" input parameter.
+    */
+   bool d_record_migration;
+
    /*!
     * @brief See "summarize_map" input parameter.
     */
@@ -839,6 +933,12 @@ private:
    mutable std::vector<double> d_load_stat;
    mutable std::vector<int> d_box_count_stat;
 
+   /*
+    * Statistics on cells and estimated bytes moved off the local process.
+    */
+   mutable std::vector<double> d_migrated_cells_stat;
+   mutable std::vector<double> d_migrated_bytes_stat;
+
    //@}
 
    // Extra checks independent of optimization/debug.
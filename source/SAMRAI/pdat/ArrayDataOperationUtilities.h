@@ -116,6 +116,33 @@ private:
 
 };
 
+/*!
+ * @brief Struct ArrayDataContiguousOperation<TYPE, OP> applies an
+ * operation to one contiguous run of array elements.
+ *
+ * This is the innermost loop of ArrayDataOperationUtilities.  The
+ * generic version calls the operation on each element.  Copy and sum
+ * of a run are specialized to a block copy and to a plain unit-stride
+ * loop that the compiler can vectorize, since these back nearly every
+ * ghost fill, pack and unpack.
+ */
+
+template<class TYPE, class OP>
+struct ArrayDataContiguousOperation
+{
+   /*!
+    * Apply op to dst[i] and src[i] for 0 <= i < n.
+    *
+    * @pre (n == 0) || ((dst != 0) && (src != 0))
+    */
+   static void
+   apply(
+      TYPE* dst,
+      const TYPE* src,
+      size_t n,
+      const OP& op);
+};
+
 }
 }
 
@@ -35,7 +35,9 @@ namespace pdat {
  * \endverbatim
  * Note that the cell iterator may not compile to efficient code, depending
  * on your compiler.  Many compilers are not smart enough to optimize the
- * looping constructs and indexing operations.
+ * looping constructs and indexing operations.  Cell indices are the
+ * indices of the box, so hier::for_each_index(box, body) visits the same
+ * cells in the same order using nested loops.
  *
  * @see CellData
  * @see CellGeometry
@@ -100,6 +100,16 @@ public:
    virtual const hier::Transformation&
    getTransformation() const;
 
+   /*!
+    * @brief Append the boxes of the overlap to boxes.  This method
+    * over-rides the virtual function in the hier::BoxOverlap base class.
+    *
+    * @return true
+    */
+   virtual bool
+   getBoundingBoxes(
+      hier::BoxContainer& boxes) const;
+
    /**
     * Output the boxes in the overlap region.
     */
@@ -101,6 +101,15 @@ public:
    virtual const hier::Transformation&
    getTransformation() const;
 
+   /*!
+    * @brief Append the face boxes of the overlap for all axes to boxes.
+    *
+    * @return true
+    */
+   virtual bool
+   getBoundingBoxes(
+      hier::BoxContainer& boxes) const;
+
 private:
    bool d_is_overlap_empty;
    hier::Transformation d_transformation;
@@ -35,7 +35,10 @@ namespace pdat {
  * \endverbatim
  * Note that the node iterator may not compile to efficient code, depending
  * on your compiler.  Many compilers are not smart enough to optimize the
- * looping constructs and indexing operations.
+ * looping constructs and indexing operations.  The node indices of a box
+ * are the indices of NodeGeometry::toNodeBox(box), so
+ * hier::for_each_index(NodeGeometry::toNodeBox(box), body) visits the
+ * same nodes in the same order using nested loops.
  *
  * @see NodeData
  * @see NodeGeometry
@@ -92,6 +92,15 @@ public:
    virtual const hier::Transformation&
    getTransformation() const;
 
+   /*!
+    * @brief Append the node boxes of the overlap to boxes.
+    *
+    * @return true
+    */
+   virtual bool
+   getBoundingBoxes(
+      hier::BoxContainer& boxes) const;
+
 private:
    bool d_is_overlap_empty;
    hier::Transformation d_transformation;
@@ -19,6 +19,7 @@
 #include "SAMRAI/hier/PatchHierarchy.h"
 #include "SAMRAI/hier/Variable.h"
 #include "SAMRAI/tbox/PIO.h"
+#include "SAMRAI/tbox/ReductionBatch.h"
 
 #include <string>
 #include <iostream>
@@ -600,6 +601,83 @@ public:
       const std::shared_ptr<SAMRAIVectorReal<TYPE> >& x,
       bool local_only = false) const;
 
+   /**
+    * Set this = alpha * x + beta * y on the patch interiors and return the
+    * dot product of the result with z.  Each component is read once, and
+    * all components share one global reduction, so this is faster than
+    * linearSum() followed by dot().  The vector z may be this vector.
+    */
+   TYPE
+   linearSumAndDot(
+      const TYPE& alpha,
+      const std::shared_ptr<SAMRAIVectorReal<TYPE> >& x,
+      const TYPE& beta,
+      const std::shared_ptr<SAMRAIVectorReal<TYPE> >& y,
+      const std::shared_ptr<SAMRAIVectorReal<TYPE> >& z,
+      bool local_only = false);
+
+   /**
+    * Set this = alpha * x + beta * y on the patch interiors and return the
+    * weighted root mean squared norm of the result, as weightedRMSNorm()
+    * does.  The update and the norm are done in one sweep over each
+    * component.
+    */
+   double
+   linearSumAndWeightedRMSNorm(
+      const TYPE& alpha,
+      const std::shared_ptr<SAMRAIVectorReal<TYPE> >& x,
+      const TYPE& beta,
+      const std::shared_ptr<SAMRAIVectorReal<TYPE> >& y,
+      const std::shared_ptr<SAMRAIVectorReal<TYPE> >& wgt);
+
+   /**
+    * Set this = alpha * x on the patch interiors and return the
+    * @f$ \max @f$ -norm of the result, as maxNorm() does.  The update and
+    * the norm are done in one sweep over each component.
+    */
+   double
+   scaleAndMaxNorm(
+      const TYPE& alpha,
+      const std::shared_ptr<SAMRAIVectorReal<TYPE> >& x,
+      bool local_only = false);
+
+   /**
+    * Add the local part of L1Norm() to a batch of global reductions.
+    * The global reduction is done by the batch, so several norms and
+    * dot products can share one non-blocking Allreduce.  Returns the
+    * handle for tbox::ReductionBatch::getValue().
+    */
+   int
+   addL1Norm(
+      tbox::ReductionBatch& batch) const;
+
+   /**
+    * Add the local part of the square of L2Norm() to a batch of global
+    * reductions.  The global @f$ L_2 @f$ -norm is the square root of the
+    * batch's value.  Returns the handle for
+    * tbox::ReductionBatch::getValue().
+    */
+   int
+   addSquaredL2Norm(
+      tbox::ReductionBatch& batch) const;
+
+   /**
+    * Add the local part of maxNorm() to a batch of global reductions.
+    * Returns the handle for tbox::ReductionBatch::getValue().
+    */
+   int
+   addMaxNorm(
+      tbox::ReductionBatch& batch) const;
+
+   /**
+    * Add the local part of the dot product with x to a batch of global
+    * reductions.  Returns the handle for tbox::ReductionBatch::getValue().
+    */
+   int
+   addDot(
+      tbox::ReductionBatch& batch,
+      const std::shared_ptr<SAMRAIVectorReal<TYPE> >& x) const;
+
    /**
     * Return 1 if @f$ \|x_i\| > 0 @f$  and @f$ w_i * x_i \leq 0 @f$ , for any @f$ i @f$  in
     * the set of vector data indices, where @f$ cvol_i > 0 @f$ .  Here, @f$ w_i @f$  is
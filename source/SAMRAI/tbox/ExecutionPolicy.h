@@ -11,19 +11,28 @@
 #ifndef included_tbox_ExecutionPolicy
 #define included_tbox_ExecutionPolicy
 
-#if defined(HAVE_RAJA)
+#include "SAMRAI/SAMRAI_config.h"
 
+#if defined(HAVE_RAJA)
 #include "RAJA/RAJA.hpp"
+#endif
 
 namespace SAMRAI {
 namespace tbox {
 
+/*
+ * Policy tags used to select how loop kernels are executed.  The tags
+ * are available in all configurations so that hier::for_all can select
+ * between sequential and threaded host loops when RAJA is not used.
+ */
 namespace policy {
 struct base {};
 struct sequential : base {};
 struct parallel : base {};
 }
 
+#if defined(HAVE_RAJA)
+
 namespace detail {
 
 template <typename pol>
@@ -111,9 +120,46 @@ struct policy_traits<policy::parallel> {
    using ReductionPolicy = RAJA::cuda_reduce;
 };
 
+#elif defined(HAVE_OPENMP)
+
+/*
+ * CPU threaded execution.  Only the outermost loop of the multi-dimensional
+ * kernels is distributed among the OpenMP threads so that the innermost
+ * (unit stride) loop remains contiguous within a thread.
+ */
+template <>
+struct policy_traits<policy::parallel> {
+   using Policy = RAJA::omp_parallel_for_exec;
+
+   using Policy1d = RAJA::KernelPolicy<
+      RAJA::statement::For<0, RAJA::omp_parallel_for_exec,
+         RAJA::statement::Lambda<0>
+      >
+   >;
+
+   using Policy2d = RAJA::KernelPolicy<
+      RAJA::statement::For<1, RAJA::omp_parallel_for_exec,
+         RAJA::statement::For<0, RAJA::loop_exec,
+            RAJA::statement::Lambda<0>
+         >
+      >
+   >;
+
+   using Policy3d = RAJA::KernelPolicy<
+      RAJA::statement::For<2, RAJA::omp_parallel_for_exec,
+         RAJA::statement::For<1, RAJA::loop_exec,
+            RAJA::statement::For<0, RAJA::loop_exec,
+               RAJA::statement::Lambda<0>
+            >
+         >
+      >
+   >;
+
+   using ReductionPolicy = RAJA::omp_reduce;
+};
+
 #else
 
-// TODO: Make this an OpenMP policy if that is defined
 template <>
 struct policy_traits<policy::parallel> {
    using Policy = RAJA::loop_exec;
@@ -149,9 +195,9 @@ struct policy_traits<policy::parallel> {
 
 } // namespace detail
 
+#endif // HAVE_RAJA
+
 }
 }
 
-#endif // HAVE_RAJA
-
 #endif
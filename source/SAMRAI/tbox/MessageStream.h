@@ -145,6 +145,37 @@ public:
       d_grow_as_needed = true;
    }
 
+   /*!
+    * @brief Discard the data in a Write-mode stream so that it can be
+    * packed again.
+    *
+    * The allocated buffer is kept, so repacking no more than the
+    * previous amount of data reuses the same memory.
+    *
+    * @pre writeMode()
+    */
+   void
+   rewind()
+   {
+      TBOX_ASSERT(writeMode());
+      d_write_buffer.clear();
+      d_buffer_size = 0;
+      d_buffer_index = 0;
+   }
+
+   /*!
+    * @brief Return the number of bytes allocated for a Write-mode
+    * stream's buffer.
+    *
+    * @pre writeMode()
+    */
+   size_t
+   getCapacity() const
+   {
+      TBOX_ASSERT(writeMode());
+      return d_write_buffer.capacity();
+   }
+
    /*!
     * @brief Whether a Read-mode MessageStream has reached the end of
     * its data.
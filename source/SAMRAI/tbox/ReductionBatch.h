@@ -0,0 +1,208 @@
+/*************************************************************************
+ *
+ * This file is part of the SAMRAI distribution.  For full copyright
+ * information, see COPYRIGHT and LICENSE.
+ *
+ * Copyright:     (c) 1997-2020 Lawrence Livermore National Security, LLC
+ * Description:   Batch of global reductions done in one non-blocking sweep.
+ *
+ ************************************************************************/
+
+#ifndef included_tbox_ReductionBatch
+#define included_tbox_ReductionBatch
+
+#include "SAMRAI/SAMRAI_config.h"
+
+#include "SAMRAI/tbox/SAMRAI_MPI.h"
+#include "SAMRAI/tbox/Utilities.h"
+
+#include <vector>
+
+namespace SAMRAI {
+namespace tbox {
+
+/*!
+ * @brief Collects the local parts of several global reductions and
+ * completes them with one non-blocking Allreduce per reduction
+ * operation.
+ *
+ * Solvers often need several dot products and norms per iteration.
+ * Reducing each one separately costs one latency-bound Allreduce per
+ * value.  With a ReductionBatch, the local values are added with
+ * addSum(), addMax() or addMin(), which return a handle.  All sums go
+ * into one Iallreduce and all maxima and minima into another, started
+ * by beginReduction().  Local work can proceed until the results are
+ * needed.  getValue() then waits for the reductions to complete.
+ *
+ * @code
+ *    tbox::ReductionBatch batch(mpi);
+ *    const int rr = r->addDot(batch, r);
+ *    const int rz = r->addDot(batch, z);
+ *    batch.beginReduction();
+ *    ... work not depending on the results ...
+ *    const double rr_global = batch.getValue(rr);
+ * @endcode
+ *
+ * Without run-time MPI, or with one process, the local values are the
+ * global values and no communication is done.
+ *
+ * The batch can be reused with clear().  It is an error to add values
+ * while a reduction is in progress.
+ */
+class ReductionBatch
+{
+public:
+   /*!
+    * @brief Constructor.
+    *
+    * @param[in] mpi The processes that take part in the reductions.
+    */
+   explicit ReductionBatch(
+      const SAMRAI_MPI& mpi);
+
+   /*!
+    * @brief Destructor waits for any reduction in progress.
+    */
+   ~ReductionBatch();
+
+   /*!
+    * @brief Add a value to be summed over all processes.
+    *
+    * @return Handle for getValue().
+    *
+    * @pre !isReducing()
+    */
+   int
+   addSum(
+      double local_value);
+
+   /*!
+    * @brief Add a value whose maximum over all processes is wanted.
+    *
+    * @return Handle for getValue().
+    *
+    * @pre !isReducing()
+    */
+   int
+   addMax(
+      double local_value);
+
+   /*!
+    * @brief Add a value whose minimum over all processes is wanted.
+    *
+    * @return Handle for getValue().
+    *
+    * @pre !isReducing()
+    */
+   int
+   addMin(
+      double local_value);
+
+   /*!
+    * @brief Return the number of values in the batch.
+    */
+   int
+   getNumberOfValues() const
+   {
+      return static_cast<int>(d_slot.size());
+   }
+
+   /*!
+    * @brief Start the global reductions of all values added so far.
+    *
+    * All processes in the SAMRAI_MPI must call this, adding the same
+    * kinds of values in the same order.
+    *
+    * @pre !isReducing()
+    */
+   void
+   beginReduction();
+
+   /*!
+    * @brief Return whether a reduction has been started and is not
+    * yet known to be complete.
+    */
+   bool
+   isReducing() const
+   {
+      return d_reducing;
+   }
+
+   /*!
+    * @brief Check for completion of the reductions without blocking.
+    *
+    * @return Whether the global values are available.
+    */
+   bool
+   checkReduction();
+
+   /*!
+    * @brief Wait for the reductions to complete.
+    */
+   void
+   completeReduction();
+
+   /*!
+    * @brief Return a global value, waiting for the reductions to
+    * complete if needed.
+    *
+    * @param[in] handle Value returned by addSum(), addMax() or
+    * addMin().
+    *
+    * @pre handle >= 0 && handle < getNumberOfValues()
+    * @pre The reductions have been started with beginReduction().
+    */
+   double
+   getValue(
+      int handle);
+
+   /*!
+    * @brief Remove all values so the batch can be reused.
+    *
+    * Waits for any reduction in progress.
+    */
+   void
+   clear();
+
+private:
+   // Unimplemented copy constructor.
+   ReductionBatch(
+      const ReductionBatch& other);
+
+   // Unimplemented assignment operator.
+   ReductionBatch&
+   operator = (
+      const ReductionBatch& rhs);
+
+   SAMRAI_MPI d_mpi;
+
+   //! @brief Local and global values to sum.
+   std::vector<double> d_local_sum;
+   std::vector<double> d_global_sum;
+
+   /*!
+    * @brief Local and global values to maximize.  Minima are stored
+    * negated.
+    */
+   std::vector<double> d_local_max;
+   std::vector<double> d_global_max;
+
+   /*!
+    * @brief Where each handle's value is.  A value i >= 0 is
+    * d_global_sum[i].  A value i < 0 is d_global_max[-i-1].
+    */
+   std::vector<int> d_slot;
+
+   //! @brief Whether each handle is a minimum, stored negated.
+   std::vector<bool> d_negated;
+
+   SAMRAI_MPI::Request d_request[2];
+
+   bool d_started;
+   bool d_reducing;
+};
+
+}
+}
+
+#endif
@@ -405,12 +405,29 @@ public:
    Request_free(
       Request* request);
 
+   static int
+   Start(
+      Request* request);
+
+   static int
+   Startall(
+      int count,
+      Request* array_of_requests);
+
    static int
    Test(
       Request* request,
       int* flag,
       Status* status);
 
+   static int
+   Testsome(
+      int incount,
+      Request* array_of_requests,
+      int* outcount,
+      int* array_of_indices,
+      Status* array_of_statuses);
+
    static int
    Test_cancelled(
       Status* status,
@@ -498,6 +515,21 @@ public:
       Datatype datatype,
       Op op) const;
 
+   /*!
+    * @brief Non-blocking Allreduce.
+    *
+    * With an MPI library older than version 3, this does a blocking
+    * Allreduce and sets request to MPI_REQUEST_NULL.
+    */
+   int
+   Iallreduce(
+      void* sendbuf,
+      void* recvbuf,
+      int count,
+      Datatype datatype,
+      Op op,
+      Request* request) const;
+
    int
    Attr_get(
       int keyval,
@@ -599,6 +631,15 @@ public:
       int tag,
       Status* status) const;
 
+   int
+   Recv_init(
+      void* buf,
+      int count,
+      Datatype datatype,
+      int source,
+      int tag,
+      Request* request) const;
+
    int
    Reduce(
       void* sendbuf,
@@ -616,6 +657,15 @@ public:
       int dest,
       int tag) const;
 
+   int
+   Send_init(
+      void* buf,
+      int count,
+      Datatype datatype,
+      int dest,
+      int tag,
+      Request* request) const;
+
    int
    Sendrecv(
       void* sendbuf,
@@ -22,6 +22,7 @@
 #include <map>
 #include <list>
 #include <memory>
+#include <vector>
 
 namespace SAMRAI {
 namespace tbox {
@@ -101,6 +102,41 @@ public:
    appendTransaction(
       const std::shared_ptr<Transaction>& transaction);
 
+   /*!
+    * @brief Append all transactions of another schedule to the tail of
+    * the list of transactions in this schedule.
+    *
+    * The transactions are shared with the other schedule, not copied.
+    * For each communication peer, the other schedule's transactions
+    * follow those already in this schedule, in the order they have in
+    * the other schedule.  Appending the same sequence of schedules on
+    * every process therefore keeps the send and receive sides of each
+    * message consistent, and messages of several schedules may be
+    * combined into one per peer.
+    *
+    * @param other  Schedule whose transactions are appended.
+    *
+    * @pre &other != this
+    * @pre getMPI().getCommunicator() == other.getMPI().getCommunicator()
+    */
+   void
+   appendTransactions(
+      const Schedule& other);
+
+   /*!
+    * @brief Notify the schedule that the data objects read or written
+    * by its transactions may have changed.
+    *
+    * The schedule derives from Transaction::getDataObjects() which local
+    * copies may run concurrently and whether messages may be unpacked
+    * between sends, and keeps that until transactions are added.  Owners
+    * that change the objects their transactions refer to without adding
+    * transactions, such as RefineSchedule::reset(), must call this
+    * method.
+    */
+   void
+   invalidateDataObjects();
+
    /*!
     * @brief Return number of send transactions in the schedule.
     */
@@ -137,9 +173,19 @@ public:
    setMPI(
       const SAMRAI_MPI& mpi)
    {
+      freePersistentCommunication();
       d_mpi = mpi;
    }
 
+   /*!
+    * @brief Get the MPI communicator used for communication.
+    */
+   const SAMRAI_MPI&
+   getMPI() const
+   {
+      return d_mpi;
+   }
+
    /*!
     * @brief Specify MPI tag values to use in communication.
     *
@@ -158,6 +204,7 @@ public:
    {
       TBOX_ASSERT(first_tag >= 0);
       TBOX_ASSERT(second_tag >= 0);
+      freePersistentCommunication();
       d_first_tag = first_tag;
       d_second_tag = second_tag;
    }
@@ -248,6 +295,124 @@ public:
       d_unpack_in_deterministic_order = flag;
    }
 
+   /*!
+    * @brief Set whether to keep message buffers and MPI requests
+    * between communication cycles.
+    *
+    * By default every communication cycle allocates new message
+    * buffers and posts new MPI sends and receives.  For a schedule
+    * that is executed many times, persistent communication keeps a
+    * buffer and a persistent MPI request (MPI_Send_init/MPI_Recv_init)
+    * for each peer and restarts them (MPI_Startall) in each cycle.
+    * Buffers are reallocated only if messages grow.
+    *
+    * Persistent communication is used only for peers whose messages
+    * can be sized by the receiver, as reported by
+    * Transaction::canEstimateIncomingMessageSize().  Other peers are
+    * communicated as in the default mode.  Receives are posted with
+    * the estimated size, so it is an error for the transactions of a
+    * persistent peer to pack more than computeOutgoingMessageSize()
+    * reports.
+    *
+    * The default is set by the input parameter
+    * "use_persistent_communication" in the "Schedule" input database,
+    * and is false if that is not given.
+    *
+    * @param [in] flag
+    *
+    * @pre The flag must have the same value on all processes
+    * communicating through this schedule.
+    * @pre !allocatedCommunicationObjects()
+    */
+   void
+   setPersistentCommunicationFlag(
+      bool flag);
+
+   /*!
+    * @brief Return whether message buffers and MPI requests are kept
+    * between communication cycles.
+    *
+    * @see setPersistentCommunicationFlag()
+    */
+   bool
+   getPersistentCommunicationFlag() const
+   {
+      return d_persistent_communication;
+   }
+
+   /*!
+    * @brief Set whether communicate() may unpack messages while it is
+    * still packing and sending others.
+    *
+    * By default all outgoing messages are packed and sent before any
+    * incoming message is unpacked.  In pipelined mode, messages that
+    * have arrived are unpacked after each send, hiding unpacking behind
+    * the latency of the remaining messages.  Messages may then be
+    * unpacked before the local copies are performed.
+    *
+    * Pipelining applies only to communicate(), and only if messages are
+    * not unpacked in deterministic order.  It is also skipped if any
+    * object written by unpacking may be read by packing or by a local
+    * copy, if unpacking and a local copy may write the same part of an
+    * object, or if that cannot be determined from
+    * Transaction::getDataObjects() and
+    * Transaction::getDestinationRegions().
+    *
+    * The default is set by the input parameter
+    * "use_pipelined_communication" in the "Schedule" input database,
+    * and is false if that is not given.
+    *
+    * @param [in] flag
+    */
+   void
+   setPipelinedCommunicationFlag(
+      bool flag)
+   {
+      d_pipelined_communication = flag;
+   }
+
+   /*!
+    * @brief Return the number of communication cycles of this schedule
+    * that unpacked messages between sends.
+    *
+    * @see setPipelinedCommunicationFlag()
+    */
+   int
+   getNumberOfPipelinedCommunications() const
+   {
+      return d_num_pipelined_communications;
+   }
+
+   /*!
+    * @brief Return the number of bytes of message buffers allocated
+    * by the most recent communication cycle.
+    *
+    * In the default mode this is the size of all messages sent and
+    * received.  With persistent communication it is nonzero only for
+    * cycles that had to create or grow buffers.
+    */
+   size_t
+   getNumBytesAllocated() const
+   {
+      return d_num_bytes_allocated;
+   }
+
+   /*!
+    * @brief Return an estimate of the bytes used by the transactions
+    * and the containers holding them.
+    */
+   size_t
+   getTransactionMemoryFootprint() const;
+
+   /*!
+    * @brief Return the bytes of message buffers currently held.
+    *
+    * This includes the buffers kept between cycles in persistent mode
+    * and, during a communication cycle, the buffers allocated for it.
+    */
+   size_t
+   getMessageBufferMemoryFootprint() const;
+
    /*!
     * @brief Setup names of timers.
     *
@@ -273,7 +438,7 @@ public:
     * @brief Returns true if the communication objects have been allocated.
     */
    bool
-   allocatedCommunicationObjects()
+   allocatedCommunicationObjects() const
    {
       return d_coms != 0;
    }
@@ -306,10 +471,43 @@ private:
    void
    performLocalCopies();
    void
+   groupLocalCopies();
+   void
+   progressCommunications();
+   void
    processCompletedCommunications();
    void
+   unpackMessage(
+      AsyncCommPeer<char>& completed_comm);
+   void
+   unpackCompletedMessages();
+   void
+   checkUnpackDuringSends();
+   static bool
+   regionsIntersect(
+      const std::vector<DatabaseBox>& regions_a,
+      const std::vector<DatabaseBox>& regions_b);
+   void
    deallocateSendBuffers();
 
+   void
+   setupPersistentCommunication();
+   void
+   freePersistentCommunication();
+   void
+   postPersistentReceives();
+   void
+   postPersistentSends();
+   void
+   processCompletedPersistentCommunications();
+   void
+   unpackCompletedPersistentMessages(
+      bool wait);
+   void
+   unpackPersistentMessage(
+      size_t irecv,
+      SAMRAI_MPI::Status& status);
+
    Schedule(
       const Schedule&);                 // not implemented
    Schedule&
@@ -350,6 +548,108 @@ private:
     */
    std::list<std::shared_ptr<Transaction> > d_local_set;
 
+   /*!
+    * @brief Local transactions grouped by the object they write, for
+    * performing local copies on multiple threads.
+    *
+    * Each group keeps the order of d_local_set.  The groups are empty
+    * if the local copies must all be performed in order.
+    */
+   std::vector<std::vector<Transaction *> > d_local_copy_groups;
+
+   /*!
+    * @brief Whether d_local_copy_groups reflects d_local_set.
+    */
+   bool d_local_copy_groups_are_current;
+
+   /*!
+    * @brief Whether to perform local copies on multiple threads when
+    * OpenMP is enabled.
+    *
+    * Set by the input parameter "thread_local_copies" in the "Schedule"
+    * input database, and false if that is not given.  Only transactions
+    * whose data objects are known are copied concurrently, so the
+    * copies of PatchData and transaction classes that may be run on
+    * multiple threads must be thread safe.
+    */
+   static bool s_thread_local_copies;
+
+   //@{ @name Persistent communication
+
+   /*!
+    * @brief Message buffer and size for one peer, kept between
+    * communication cycles in persistent mode.
+    */
+   struct PersistentMessage {
+      PersistentMessage():
+         peer_rank(-1),
+         size(0),
+         buffer(0) {
+      }
+      int peer_rank;
+      //! @brief Stream packed for sending.  Unused for receives.
+      std::shared_ptr<MessageStream> send_stream;
+      //! @brief Buffer to receive into.  Unused for sends.
+      std::vector<char> recv_buffer;
+      //! @brief Message size the MPI request was initialized with.
+      size_t size;
+      //! @brief Buffer the MPI request was initialized with.
+      const void* buffer;
+   };
+
+   /*!
+    * @brief Whether to keep message buffers and MPI requests between
+    * communication cycles.
+    *
+    * @see setPersistentCommunicationFlag()
+    */
+   bool d_persistent_communication;
+
+   /*!
+    * @brief Whether transactions have been sorted into persistent and
+    * non-persistent peers.
+    */
+   bool d_persistent_is_set_up;
+
+   /*!
+    * @brief Transactions with peers that are communicated with
+    * persistent requests.
+    *
+    * These are moved out of d_send_sets and d_recv_sets by
+    * setupPersistentCommunication() and back by
+    * freePersistentCommunication().
+    */
+   TransactionSets d_persistent_send_sets;
+   TransactionSets d_persistent_recv_sets;
+
+   /*!
+    * @brief Messages for d_persistent_recv_sets and
+    * d_persistent_send_sets, in the same order.
+    */
+   std::vector<PersistentMessage> d_persistent_recvs;
+   std::vector<PersistentMessage> d_persistent_sends;
+
+   /*!
+    * @brief Persistent MPI requests, for d_persistent_recvs followed by
+    * d_persistent_sends.
+    */
+   std::vector<SAMRAI_MPI::Request> d_persistent_requests;
+
+   /*!
+    * @brief Default for d_persistent_communication, from input.
+    */
+   static bool s_default_persistent_communication;
+
+   //@}
+
+   /*!
+    * @brief Bytes of message buffers allocated in the current or most
+    * recent communication cycle.
+    *
+    * @see getNumBytesAllocated()
+    */
+   size_t d_num_bytes_allocated;
+
    //@{ @name High-level asynchronous messages passing objects
 
    /*!
@@ -400,6 +700,43 @@ private:
     */
    bool d_unpack_in_deterministic_order;
 
+   /*!
+    * @brief Whether communicate() may unpack messages between sends.
+    *
+    * @see setPipelinedCommunicationFlag()
+    */
+   bool d_pipelined_communication;
+
+   /*!
+    * @brief Whether no object written by unpacking is read by packing
+    * or by a local copy, and no part of one written by a local copy, so
+    * that unpacking may be done between sends.
+    */
+   bool d_can_unpack_during_sends;
+
+   /*!
+    * @brief Whether d_can_unpack_during_sends reflects the current
+    * transactions.
+    */
+   bool d_can_unpack_during_sends_is_current;
+
+   /*!
+    * @brief Whether the current communication cycle unpacks messages
+    * between sends.
+    */
+   bool d_unpack_during_sends;
+
+   /*!
+    * @brief Number of communication cycles that unpacked messages
+    * between sends.
+    */
+   int d_num_pipelined_communications;
+
+   /*!
+    * @brief Default for d_pipelined_communication, from input.
+    */
+   static bool s_default_pipelined_communication;
+
    static const int s_default_first_tag;
    static const int s_default_second_tag;
    static const size_t s_default_first_message_length;
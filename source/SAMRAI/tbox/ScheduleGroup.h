@@ -0,0 +1,218 @@
+/*************************************************************************
+ *
+ * This file is part of the SAMRAI distribution.  For full copyright
+ * information, see COPYRIGHT and LICENSE.
+ *
+ * Copyright:     (c) 1997-2020 Lawrence Livermore National Security, LLC
+ * Description:   Group of schedules communicated as one
+ *
+ ************************************************************************/
+#ifndef included_tbox_ScheduleGroup
+#define included_tbox_ScheduleGroup
+
+#include "SAMRAI/SAMRAI_config.h"
+
+#include "SAMRAI/tbox/Schedule.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace SAMRAI {
+namespace tbox {
+
+/*!
+ * @brief Class ScheduleGroup executes the transactions of several
+ * Schedules in one communication phase.
+ *
+ * Executing several schedules one after the other sends at least one
+ * message to each peer per schedule and waits for each schedule's
+ * messages separately.  When the schedules are independent, a
+ * ScheduleGroup combines them into one schedule so that each peer
+ * receives a single message holding the data of all member schedules
+ * and there is a single wait phase.  When message latency dominates,
+ * this divides the message count by the number of schedules.
+ *
+ * The combined schedule shares the members' transactions and is built
+ * on the first communication after a change in membership, so a group
+ * may be executed many times at no extra setup cost.  Transactions
+ * added to a member schedule after that are not seen by the group
+ * until the membership is changed again.
+ *
+ * Members must be independent: no transaction of one member may read
+ * data written by a transaction of another member, since their
+ * transactions are executed in an unspecified order relative to each
+ * other.  All processes must add the same schedules in the same order,
+ * and all members must use the same MPI communicator.
+ *
+ * @see Schedule
+ */
+
+class ScheduleGroup
+{
+public:
+   /*!
+    * @brief Create an empty group.
+    */
+   ScheduleGroup();
+
+   /*!
+    * @brief The destructor releases the combined schedule.
+    *
+    * @pre !allocatedCommunicationObjects()
+    */
+   ~ScheduleGroup();
+
+   /*!
+    * @brief Add a schedule to the end of the group.
+    *
+    * @param schedule
+    *
+    * @pre schedule
+    * @pre !allocatedCommunicationObjects()
+    */
+   void
+   addSchedule(
+      const std::shared_ptr<Schedule>& schedule);
+
+   /*!
+    * @brief Remove all schedules from the group.
+    *
+    * @pre !allocatedCommunicationObjects()
+    */
+   void
+   clear();
+
+   /*!
+    * @brief Return the number of schedules in the group.
+    */
+   int
+   getNumberOfSchedules() const
+   {
+      return static_cast<int>(d_schedules.size());
+   }
+
+   /*!
+    * @brief Return the schedule at the given position in the group.
+    *
+    * @pre i >= 0 && i < getNumberOfSchedules()
+    */
+   const std::shared_ptr<Schedule>&
+   getSchedule(
+      int i) const
+   {
+      TBOX_ASSERT(i >= 0 && i < getNumberOfSchedules());
+      return d_schedules[i];
+   }
+
+   /*!
+    * @brief Perform the communication of all member schedules.
+    *
+    * This is Schedule::communicate() on the combined schedule.
+    */
+   void
+   communicate();
+
+   /*!
+    * @brief Begin the communication of all member schedules.
+    *
+    * This method must be followed by a call to
+    * <TT>finalizeCommunication()</TT>.
+    */
+   void
+   beginCommunication();
+
+   /*!
+    * @brief Finish the communication of all member schedules and
+    * deliver the messages.
+    */
+   void
+   finalizeCommunication();
+
+   /*!
+    * @brief Whether the combined schedule has communication objects
+    * allocated, i.e., is in the middle of a communication phase.
+    */
+   bool
+   allocatedCommunicationObjects() const
+   {
+      return d_combined_schedule &&
+             d_combined_schedule->allocatedCommunicationObjects();
+   }
+
+   /*!
+    * @brief Set whether to unpack messages in a deterministic order.
+    *
+    * @see Schedule::setDeterministicUnpackOrderingFlag()
+    *
+    * @param [in] flag
+    */
+   void
+   setDeterministicUnpackOrderingFlag(
+      bool flag)
+   {
+      d_unpack_in_deterministic_order = flag;
+      if (d_combined_schedule) {
+         d_combined_schedule->setDeterministicUnpackOrderingFlag(flag);
+      }
+   }
+
+   /*!
+    * @brief Set the prefix of the timers used by the combined schedule.
+    *
+    * @see Schedule::setTimerPrefix()
+    *
+    * @param [in] timer_prefix
+    */
+   void
+   setTimerPrefix(
+      const std::string& timer_prefix)
+   {
+      d_timer_prefix = timer_prefix;
+      if (d_combined_schedule) {
+         d_combined_schedule->setTimerPrefix(timer_prefix);
+      }
+   }
+
+private:
+   // Unimplemented copy constructor.
+   ScheduleGroup(
+      const ScheduleGroup&);
+
+   // Unimplemented assignment operator.
+   ScheduleGroup&
+   operator = (
+      const ScheduleGroup&);
+
+   /*!
+    * @brief Build the combined schedule from the member schedules.
+    */
+   void
+   combineSchedules();
+
+   /*!
+    * @brief The member schedules, in the order they were added.
+    */
+   std::vector<std::shared_ptr<Schedule> > d_schedules;
+
+   /*!
+    * @brief Schedule holding the transactions of all members, or null
+    * if it must be rebuilt.
+    */
+   std::shared_ptr<Schedule> d_combined_schedule;
+
+   /*!
+    * @brief Deterministic unpack flag for the combined schedule.
+    */
+   bool d_unpack_in_deterministic_order;
+
+   /*!
+    * @brief Timer prefix for the combined schedule.
+    */
+   std::string d_timer_prefix;
+};
+
+}
+}
+
+#endif
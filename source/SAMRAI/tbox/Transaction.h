@@ -13,9 +13,11 @@
 
 #include "SAMRAI/SAMRAI_config.h"
 
+#include "SAMRAI/tbox/DatabaseBox.h"
 #include "SAMRAI/tbox/MessageStream.h"
 
 #include <iostream>
+#include <vector>
 
 namespace SAMRAI {
 namespace tbox {
@@ -103,6 +105,56 @@ public:
    virtual void
    copyLocalData() = 0;
 
+   /**
+    * Identify the objects this transaction reads and writes on the
+    * local process.
+    *
+    * Set destination to the object written by copyLocalData() or
+    * unpackStream(), or to 0 if the transaction writes nothing locally
+    * (a send).  Append each object read by copyLocalData() or
+    * packStream() to sources.  The identifiers are only compared with
+    * each other, never dereferenced.
+    *
+    * Schedule uses these to perform local copies that write different
+    * objects concurrently, and to unpack messages while still packing
+    * others.  The default implementation returns false, meaning the
+    * objects are unknown, which rules out both.
+    *
+    * @return Whether destination and sources have been set.
+    */
+   virtual bool
+   getDataObjects(
+      const void *& destination,
+      std::vector<const void *>& sources);
+
+   /**
+    * Append to regions boxes that contain the index region that
+    * copyLocalData() or unpackStream() writes in the destination object
+    * of getDataObjects().  The boxes are in the index space of that
+    * object's data type.
+    *
+    * Schedule uses these to tell whether a local copy and an unpacked
+    * message that write the same object write the same data.  The
+    * default implementation returns false, meaning the region is
+    * unknown, so that any two writes to the object are taken to
+    * conflict.
+    *
+    * @return Whether regions has been set.
+    */
+   virtual bool
+   getDestinationRegions(
+      std::vector<DatabaseBox>& regions);
+
+   /**
+    * Return an estimate of the bytes used by the transaction object,
+    * not counting the patch data it refers to.
+    *
+    * The default implementation returns the size of this base class.
+    * Transactions that hold more state should override it.
+    */
+   virtual size_t
+   getMemoryFootprint() const;
+
    /**
     * Print out transaction information.
     */
@@ -145,6 +145,31 @@ public:
    virtual void
    copyLocalData();
 
+   /*!
+    * Identify the local patch data written and read by the transaction.
+    */
+   virtual bool
+   getDataObjects(
+      const void *& destination,
+      std::vector<const void *>& sources);
+
+   /*!
+    * Append the destination boxes of the overlap to regions.
+    */
+   virtual bool
+   getDestinationRegions(
+      std::vector<tbox::DatabaseBox>& regions);
+
+   /*!
+    * Return the bytes used by the transaction object.  The overlap,
+    * which may be shared with other transactions, is not counted.
+    */
+   virtual size_t
+   getMemoryFootprint() const
+   {
+      return sizeof(*this);
+   }
+
    /*!
     * Print out transaction information.
     */
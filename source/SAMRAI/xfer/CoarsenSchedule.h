@@ -16,6 +16,7 @@
 #include "SAMRAI/hier/IntVector.h"
 #include "SAMRAI/hier/ComponentSelector.h"
 #include "SAMRAI/hier/Connector.h"
+#include "SAMRAI/hier/MetadataMemoryStatistics.h"
 #include "SAMRAI/hier/PatchLevel.h"
 #include "SAMRAI/tbox/Schedule.h"
 #include "SAMRAI/tbox/Timer.h"
@@ -189,6 +190,9 @@ public:
     *                    choices are:  "DLBG" (default case),
     *                    and "ORIG_NSQUARED".   More details can be found below
     *                    in the comments for the generateSchedule() routine.
+    *                    "ORIG_NSQUARED" needs globalized levels, so "DLBG"
+    *                    is used while hier::BoxLevel::getAllowGlobalization()
+    *                    is false.
     *
     * @pre (method == "ORIG_NSQUARED") || (method == "DLBG")
     */
@@ -196,6 +200,19 @@ public:
    setScheduleGenerationMethod(
       const std::string& method);
 
+   /*!
+    * @brief Add the memory used by the schedule's transactions, message
+    * buffers and internal metadata to a MetadataMemoryStatistics.
+    *
+    * The temporary coarse level and the schedule filling it before
+    * coarsening are included.  The coarse and fine levels are not.
+    *
+    * @param[in,out] stats
+    */
+   void
+   computeMemoryFootprint(
+      hier::MetadataMemoryStatistics& stats) const;
+
    /*!
     * @brief Print the coarsen schedule state to the specified data stream.
     *
@@ -206,6 +223,12 @@ public:
       std::ostream& stream) const;
 
 private:
+   /*
+    * CoarsenScheduleGroup executes the steps of coarsenData() for
+    * several schedules in lock step, combining their communication.
+    */
+   friend class CoarsenScheduleGroup;
+
    CoarsenSchedule(
       const CoarsenSchedule&);              // not implemented
    CoarsenSchedule&
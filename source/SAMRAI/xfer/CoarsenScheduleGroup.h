@@ -0,0 +1,164 @@
+/*************************************************************************
+ *
+ * This file is part of the SAMRAI distribution.  For full copyright
+ * information, see COPYRIGHT and LICENSE.
+ *
+ * Copyright:     (c) 1997-2020 Lawrence Livermore National Security, LLC
+ * Description:   Group of coarsen schedules executed with combined messages
+ *
+ ************************************************************************/
+
+#ifndef included_xfer_CoarsenScheduleGroup
+#define included_xfer_CoarsenScheduleGroup
+
+#include "SAMRAI/SAMRAI_config.h"
+
+#include "SAMRAI/xfer/CoarsenSchedule.h"
+#include "SAMRAI/xfer/RefineScheduleGroup.h"
+#include "SAMRAI/tbox/ScheduleGroup.h"
+
+#include <memory>
+#include <vector>
+
+namespace SAMRAI {
+namespace xfer {
+
+/*!
+ * @brief Class CoarsenScheduleGroup coarsens the data of several
+ * CoarsenSchedules at once, sending one message per peer for all of
+ * them.
+ *
+ * CoarsenScheduleGroup::coarsenData() performs the same steps as
+ * CoarsenSchedule::coarsenData() on all member schedules in lock step.
+ * The transfers from the temporary coarse levels to the destination
+ * levels are executed through a single tbox::ScheduleGroup, and the
+ * coarse data fills that precede coarsening, if any, through a
+ * RefineScheduleGroup.
+ *
+ * Member schedules must be independent of each other: no member may
+ * write a patch data component that another member reads or writes on
+ * the same level.  addSchedule() checks this for the coarse and fine
+ * levels of the members.  All processes must add the corresponding
+ * schedules in the same order.
+ *
+ * @see CoarsenSchedule
+ * @see RefineScheduleGroup
+ */
+
+class CoarsenScheduleGroup
+{
+public:
+   /*!
+    * @brief Create an empty group.
+    */
+   CoarsenScheduleGroup();
+
+   /*!
+    * @brief The destructor releases the combined communication
+    * schedules but not the member schedules.
+    */
+   ~CoarsenScheduleGroup();
+
+   /*!
+    * @brief Add a schedule to the group.
+    *
+    * An unrecoverable error occurs if the schedule writes data that
+    * another member reads or writes.
+    *
+    * @param[in] schedule
+    *
+    * @pre schedule
+    */
+   void
+   addSchedule(
+      const std::shared_ptr<CoarsenSchedule>& schedule);
+
+   /*!
+    * @brief Remove all schedules from the group.
+    */
+   void
+   clear();
+
+   /*!
+    * @brief Return the number of schedules in the group.
+    */
+   int
+   getNumberOfSchedules() const
+   {
+      return static_cast<int>(d_schedules.size());
+   }
+
+   /*!
+    * @brief Execute all member schedules.
+    *
+    * The result is the same as calling CoarsenSchedule::coarsenData()
+    * on each member.
+    */
+   void
+   coarsenData();
+
+   /*!
+    * @brief Set whether to unpack messages in a deterministic order.
+    *
+    * @see CoarsenSchedule::setDeterministicUnpackOrderingFlag()
+    *
+    * @param [in] flag
+    */
+   void
+   setDeterministicUnpackOrderingFlag(
+      bool flag);
+
+private:
+   // Unimplemented copy constructor.
+   CoarsenScheduleGroup(
+      const CoarsenScheduleGroup&);
+
+   // Unimplemented assignment operator.
+   CoarsenScheduleGroup&
+   operator = (
+      const CoarsenScheduleGroup&);
+
+   /*!
+    * @brief Rebuild the combined schedules if any member's
+    * communication schedule has changed.
+    */
+   void
+   setUpGroups();
+
+   /*!
+    * @brief Report an error if one schedule writes data that the other
+    * reads or writes.
+    */
+   static void
+   checkIndependence(
+      const CoarsenSchedule& a,
+      const CoarsenSchedule& b);
+
+   /*!
+    * @brief The member schedules, in the order they were added.
+    */
+   std::vector<std::shared_ptr<CoarsenSchedule> > d_schedules;
+
+   /*!
+    * @brief Combined transfers from the temporary coarse levels to the
+    * destination levels.
+    */
+   tbox::ScheduleGroup d_schedule_group;
+
+   /*!
+    * @brief Combined fills of coarse data before coarsening, for the
+    * members that need them.
+    */
+   RefineScheduleGroup d_precoarsen_refine_group;
+
+   /*!
+    * @brief Whether d_schedule_group and d_precoarsen_refine_group hold
+    * the current members.
+    */
+   bool d_groups_are_set_up;
+};
+
+}
+}
+
+#endif
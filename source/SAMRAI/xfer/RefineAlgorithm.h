@@ -20,12 +20,15 @@
 #include "SAMRAI/hier/TimeInterpolateOperator.h"
 #include "SAMRAI/xfer/VariableFillPattern.h"
 #include "SAMRAI/hier/Connector.h"
+#include "SAMRAI/hier/MappingConnector.h"
 #include "SAMRAI/hier/Box.h"
 #include "SAMRAI/hier/BoxLevel.h"
 #include "SAMRAI/hier/PatchHierarchy.h"
 #include "SAMRAI/hier/PatchLevel.h"
 
+#include <list>
 #include <memory>
+#include <vector>
 
 namespace SAMRAI {
 namespace xfer {
@@ -112,6 +115,14 @@ namespace xfer {
  * as long as the patches involved in the communication process do not change;
  * thus, they can be used for multiple data communication cycles.
  *
+ * Applications often recreate all of their schedules after a regrid, even
+ * for levels the regrid left unchanged.  When schedule caching is turned on
+ * with setScheduleCaching(), createSchedule() returns the schedule it
+ * created earlier for the same configuration, if that schedule is still in
+ * use, instead of building a new one.  For a level that a regrid replaced
+ * by a new level with the same boxes, it builds the new schedule from the
+ * cached one, reusing its transaction overlaps.
+ *
  * @see RefineSchedule
  * @see RefinePatchStrategy
  * @see RefineClasses
@@ -250,6 +261,12 @@ public:
     *                                pointer is null (default state), then a
     *                                StandardRefineTransactionFactory object
     *                                will be used.
+    * @param[in] keep_transaction_overlaps  Whether the schedule keeps the
+    *                                       overlaps of its transactions,
+    *                                       so that updateSchedule() can
+    *                                       reuse them.  Default is false.
+    *                                       Ignored with schedule caching
+    *                                       on; see setScheduleCaching().
     *
     * @pre level
     */
@@ -258,7 +275,8 @@ public:
       const std::shared_ptr<hier::PatchLevel>& level,
       RefinePatchStrategy* patch_strategy = 0,
       const std::shared_ptr<RefineTransactionFactory>& transaction_factory =
-         std::shared_ptr<RefineTransactionFactory>());
+         std::shared_ptr<RefineTransactionFactory>(),
+      bool keep_transaction_overlaps = false);
 
    /*
     * @brief Same as the above, except with fill_pattern specified.
@@ -275,7 +293,8 @@ public:
       const std::shared_ptr<hier::PatchLevel>& level,
       RefinePatchStrategy* patch_strategy = 0,
       const std::shared_ptr<RefineTransactionFactory>& transaction_factory =
-         std::shared_ptr<RefineTransactionFactory>());
+         std::shared_ptr<RefineTransactionFactory>(),
+      bool keep_transaction_overlaps = false);
 
    /*!
     * @brief Create a communication schedule that communicates data between
@@ -317,6 +336,12 @@ public:
     *                                 null (default state), then a
     *                                 StandardRefineTransactionFactory object
     *                                 will be used.
+    * @param[in] keep_transaction_overlaps  Whether the schedule keeps the
+    *                                       overlaps of its transactions,
+    *                                       so that updateSchedule() can
+    *                                       reuse them.  Default is false.
+    *                                       Ignored with schedule caching
+    *                                       on; see setScheduleCaching().
     *
     * @pre dst_level
     * @pre src_level
@@ -329,7 +354,8 @@ public:
       RefinePatchStrategy* patch_strategy = 0,
       bool use_time_interpolation = false,
       const std::shared_ptr<RefineTransactionFactory>& transaction_factory =
-         std::shared_ptr<RefineTransactionFactory>());
+         std::shared_ptr<RefineTransactionFactory>(),
+      bool keep_transaction_overlaps = false);
 
    /*!
     * @brief Same as the above, except with fill_pattern specified.
@@ -355,7 +381,8 @@ public:
       RefinePatchStrategy* patch_strategy = 0,
       bool use_time_interpolation = false,
       const std::shared_ptr<RefineTransactionFactory>& transaction_factory =
-         std::shared_ptr<RefineTransactionFactory>());
+         std::shared_ptr<RefineTransactionFactory>(),
+      bool keep_transaction_overlaps = false);
 
    /*!
     * @brief Create a communication schedule that communicates data within a
@@ -422,6 +449,12 @@ public:
     *                                 null (default state), then a
     *                                 StandardRefineTransactionFactory object
     *                                 will be used.
+    * @param[in] keep_transaction_overlaps  Whether the schedule keeps the
+    *                                       overlaps of its transactions,
+    *                                       so that updateSchedule() can
+    *                                       reuse them.  Default is false.
+    *                                       Ignored with schedule caching
+    *                                       on; see setScheduleCaching().
     *
     * @pre level
     * @pre (next_coarser_level == -1) || hierarchy
@@ -435,7 +468,8 @@ public:
       RefinePatchStrategy* patch_strategy = 0,
       bool use_time_interpolation = false,
       const std::shared_ptr<RefineTransactionFactory>& transaction_factory =
-         std::shared_ptr<RefineTransactionFactory>());
+         std::shared_ptr<RefineTransactionFactory>(),
+      bool keep_transaction_overlaps = false);
 
    /*!
     * @brief Same as the above, except with fill_pattern specified.
@@ -463,7 +497,8 @@ public:
       RefinePatchStrategy* patch_strategy = 0,
       bool use_time_interpolation = false,
       const std::shared_ptr<RefineTransactionFactory>& transaction_factory =
-         std::shared_ptr<RefineTransactionFactory>());
+         std::shared_ptr<RefineTransactionFactory>(),
+      bool keep_transaction_overlaps = false);
 
    /*!
     * @brief Create a communication schedule that communicates data from a
@@ -546,6 +581,12 @@ public:
     *                                 null (default state), then a
     *                                 StandardRefineTransactionFactory object
     *                                 will be used.
+    * @param[in] keep_transaction_overlaps  Whether the schedule keeps the
+    *                                       overlaps of its transactions,
+    *                                       so that updateSchedule() can
+    *                                       reuse them.  Default is false.
+    *                                       Ignored with schedule caching
+    *                                       on; see setScheduleCaching().
     *
     * @pre dst_level
     * @pre (next_coarser_level == -1) || hierarchy
@@ -561,7 +602,8 @@ public:
       RefinePatchStrategy* patch_strategy = 0,
       bool use_time_interpolation = false,
       const std::shared_ptr<RefineTransactionFactory>& transaction_factory =
-         std::shared_ptr<RefineTransactionFactory>());
+         std::shared_ptr<RefineTransactionFactory>(),
+      bool keep_transaction_overlaps = false);
 
    /*!
     * @brief Same as the above, except with fill_pattern specified.
@@ -592,7 +634,8 @@ public:
       RefinePatchStrategy* patch_strategy = 0,
       bool use_time_interpolation = false,
       const std::shared_ptr<RefineTransactionFactory>& transaction_factory =
-         std::shared_ptr<RefineTransactionFactory>());
+         std::shared_ptr<RefineTransactionFactory>(),
+      bool keep_transaction_overlaps = false);
 
    /*!
     * @brief Given a previously-generated refine schedule, check for
@@ -642,6 +685,52 @@ public:
    resetSchedule(
       const std::shared_ptr<RefineSchedule>& schedule) const;
 
+   /*!
+    * @brief Create a schedule for a level that replaced the destination
+    * level of a previously-generated refine schedule.
+    *
+    * The new schedule has the configuration of old_schedule (fill pattern,
+    * coarser hierarchy levels, patch strategy, transaction factory and time
+    * interpolation) with dst_level as the destination level.  If the source
+    * level of old_schedule is its destination level, dst_level is also the
+    * source level; otherwise the source level is unchanged.  The schedule
+    * performs the communication operations registered with this algorithm,
+    * which must be consistent with old_schedule (see checkConsistency()).
+    *
+    * Transactions between boxes that the regrid did not change reuse the
+    * overlaps computed by old_schedule, so that the cost of the overlap
+    * computation is proportional to the number of changed boxes.  The
+    * schedules filling coarse interpolation levels reuse the overlaps of
+    * the corresponding schedules of old_schedule where their boxes did not
+    * change.  Schedules created by this method keep their overlaps, and so
+    * do schedules from createSchedule() with keep_transaction_overlaps or
+    * with schedule caching on.
+    * Updating a schedule that did not keep its overlaps computes all
+    * overlaps.  The overlaps are reused only if old_schedule uses the
+    * RefineClasses of this algorithm.
+    *
+    * @return std::shared_ptr to the new refine schedule.
+    *
+    * @param[in] old_schedule  Schedule for the level replaced by dst_level.
+    * @param[in] dst_level     New destination level.
+    * @param[in] old_to_new    Mapping from the destination BoxLevel of
+    *                          old_schedule to the BoxLevel of dst_level,
+    *                          such as the mapping produced by the load
+    *                          balancer.  Boxes without a neighborhood in
+    *                          the mapping are unchanged.
+    *
+    * @pre old_schedule
+    * @pre dst_level
+    * @pre d_refine_classes->classesMatch(old_schedule->getEquivalenceClasses())
+    * @pre old_to_new.getBase() == *old_schedule's destination BoxLevel
+    * @pre old_to_new.getHead() == *dst_level->getBoxLevel()
+    */
+   std::shared_ptr<RefineSchedule>
+   updateSchedule(
+      const std::shared_ptr<RefineSchedule>& old_schedule,
+      const std::shared_ptr<hier::PatchLevel>& dst_level,
+      const hier::MappingConnector& old_to_new);
+
    /*!
     * @brief Return the refine equivalence classes used in the algorithm.
     */
@@ -664,6 +753,67 @@ public:
       d_refine_classes = refine_classes;
    }
 
+   /*!
+    * @brief Set whether createSchedule() may return a schedule that it
+    * created earlier.
+    *
+    * With caching on, createSchedule() returns an existing schedule created
+    * by this algorithm if the schedule is still referenced outside the
+    * algorithm and was created for the same
+    * <ul>
+    *    <li> destination and source PatchLevel objects,
+    *    <li> hierarchy and hierarchy PatchLevel objects on the levels
+    *         coarser than the destination level,
+    *    <li> PatchLevelFillPattern object, or none for the overloads that
+    *         use the default full fill pattern,
+    *    <li> patch strategy, transaction factory and time interpolation
+    *         flag,
+    * </ul>
+    * and still uses the equivalence classes of this algorithm.  Since
+    * PatchLevels do not change after creation, a level that is not replaced
+    * by a regrid keeps its schedules.  The cache does not extend the
+    * lifetime of the schedules, so an application that replaces a schedule
+    * with the result of createSchedule() gets the old one back when nothing
+    * has changed.
+    *
+    * A regrid that leaves a level unchanged may still replace it, and the
+    * coarser levels, by new PatchLevel objects with the same boxes.  The
+    * cached schedule cannot be returned then, because it fills the patches
+    * of the replaced levels.  Instead, if the BoxLevels of all these
+    * levels are the same objects as, or have the same local boxes as,
+    * those of a cached schedule, the new schedule is created as if by
+    * updateSchedule() from the cached one and reuses all of its
+    * transaction overlaps.  Schedules created with caching on therefore
+    * keep their transaction overlaps.
+    *
+    * The returned schedule is shared by all callers that asked for the same
+    * configuration, which must not depend on it being a distinct object.
+    * Callers that need separate schedules for the same levels must pass
+    * separate fill pattern objects.  Caching must be set the same way on
+    * all processes.  Caching is off by default.
+    *
+    * @param[in] flag
+    */
+   void
+   setScheduleCaching(
+      bool flag)
+   {
+      d_cache_schedules = flag;
+      if (!flag) {
+         d_cached_schedules.clear();
+      }
+   }
+
+   /*!
+    * @brief Return whether createSchedule() may return a schedule that it
+    * created earlier.
+    */
+   bool
+   getScheduleCaching() const
+   {
+      return d_cache_schedules;
+   }
+
    /*!
     * @brief Print the refine algorithm state to the specified data stream.
     *
@@ -680,6 +830,127 @@ private:
    operator = (
       const RefineAlgorithm&);                  // not implemented
 
+   /*!
+    * @brief A PatchLevel of a cached schedule's configuration, its
+    * BoxLevel and a stamp of the BoxLevel's content.
+    *
+    * Objects are held by weak pointers, which compare by identity even
+    * after the object is gone.
+    */
+   struct CachedLevel {
+      std::weak_ptr<hier::PatchLevel> d_level;
+      std::weak_ptr<hier::BoxLevel> d_box_level;
+      size_t d_box_level_stamp;
+      bool d_is_set;
+   };
+
+   /*!
+    * @brief How a level of a configuration matches that of a cached
+    * schedule.
+    */
+   enum LevelMatch { DIFFERENT_LEVEL = 0,
+                     SAME_BOXES = 1,
+                     SAME_LEVEL = 2 };
+
+   /*!
+    * @brief A schedule created by this algorithm and the configuration it
+    * was created for.
+    */
+   struct CachedSchedule {
+      std::weak_ptr<RefineSchedule> d_schedule;
+      std::weak_ptr<PatchLevelFillPattern> d_fill_pattern;
+      CachedLevel d_dst_level;
+      CachedLevel d_src_level;
+      bool d_fill_from_coarser;
+      int d_next_coarser_ln;
+      std::weak_ptr<hier::PatchHierarchy> d_hierarchy;
+      std::vector<CachedLevel> d_coarser_levels;
+      RefinePatchStrategy* d_patch_strategy;
+      std::weak_ptr<RefineTransactionFactory> d_transaction_factory;
+      bool d_use_time_refinement;
+   };
+
+   /*!
+    * @brief Return the cached schedule for the configuration or create a
+    * new one.
+    *
+    * The fill_from_coarser flag selects the RefineSchedule constructor that
+    * fills from coarser hierarchy levels.  A null fill pattern selects
+    * PatchLevelFullFillPattern and a null transaction factory selects
+    * StandardRefineTransactionFactory.  keep_transaction_overlaps,
+    * old_schedule and old_to_new are passed to the RefineSchedule
+    * constructor.
+    */
+   std::shared_ptr<RefineSchedule>
+   findOrCreateSchedule(
+      const std::shared_ptr<PatchLevelFillPattern>& fill_pattern,
+      const std::shared_ptr<hier::PatchLevel>& dst_level,
+      const std::shared_ptr<hier::PatchLevel>& src_level,
+      bool fill_from_coarser,
+      int next_coarser_ln,
+      const std::shared_ptr<hier::PatchHierarchy>& hierarchy,
+      RefinePatchStrategy* patch_strategy,
+      bool use_time_refinement,
+      const std::shared_ptr<RefineTransactionFactory>& transaction_factory,
+      bool keep_transaction_overlaps,
+      const RefineSchedule* old_schedule = 0,
+      const hier::MappingConnector* old_to_new = 0);
+
+   /*!
+    * @brief Return the live cached schedule created for the configuration
+    * in key, or null, dropping cache entries whose schedule is gone.
+    *
+    * @param[in] key
+    * @param[out] same_boxes_schedule  The latest live cached schedule
+    *                                  whose configuration differs from
+    *                                  key only by levels with the same
+    *                                  boxes, or null.
+    */
+   std::shared_ptr<RefineSchedule>
+   findCachedSchedule(
+      const CachedSchedule& key,
+      std::shared_ptr<RefineSchedule>& same_boxes_schedule);
+
+   /*!
+    * @brief Set a CachedLevel from a PatchLevel, which may be null.
+    */
+   static void
+   setCachedLevel(
+      CachedLevel& cached_level,
+      const std::shared_ptr<hier::PatchLevel>& level);
+
+   /*!
+    * @brief Return how two CachedLevels match.
+    *
+    * Levels with BoxLevels that are the same object or have equal stamps
+    * have the same boxes.  Schedules built from the overlaps of another
+    * schedule compare the boxes of the overlaps they reuse, so a stamp
+    * collision costs only the reuse.
+    */
+   static LevelMatch
+   compareCachedLevels(
+      const CachedLevel& a,
+      const CachedLevel& b);
+
+   /*!
+    * @brief Return a stamp of the refinement ratio and the local Boxes of
+    * a BoxLevel.
+    *
+    * Like BoxLevel::operator==, this compares only the local parts, which
+    * is all a process needs to reuse its own overlaps.
+    */
+   static size_t
+   getBoxLevelStamp(
+      const hier::BoxLevel& box_level);
+
+   /*!
+    * @brief Combine a value into a stamp.
+    */
+   static void
+   combineStamp(
+      size_t& stamp,
+      size_t value);
+
    /*!
     * RefineClasses object holds all of the registered refine items
     */
@@ -690,6 +961,16 @@ private:
     */
    bool d_schedule_created;
 
+   /*!
+    * Whether createSchedule() may return a cached schedule.
+    */
+   bool d_cache_schedules;
+
+   /*!
+    * Schedules created while caching is on.
+    */
+   std::list<CachedSchedule> d_cached_schedules;
+
 };
 
 }
@@ -20,13 +20,18 @@
 #include "SAMRAI/xfer/SingularityPatchStrategy.h"
 #include "SAMRAI/hier/ComponentSelector.h"
 #include "SAMRAI/hier/IntVector.h"
+#include "SAMRAI/hier/MappingConnector.h"
+#include "SAMRAI/hier/MetadataMemoryStatistics.h"
 #include "SAMRAI/hier/PatchHierarchy.h"
 #include "SAMRAI/hier/PatchLevel.h"
 #include "SAMRAI/tbox/Schedule.h"
 #include "SAMRAI/tbox/Timer.h"
 
 #include <iostream>
+#include <map>
 #include <memory>
+#include <utility>
+#include <vector>
 
 namespace SAMRAI {
 namespace xfer {
@@ -62,6 +67,12 @@ namespace xfer {
  * - @c PatchLevelBorderAndInteriorFillPattern - Fill interior and
  *      ghosts on level borders.
  *
+ * When a regrid replaces the destination level, a schedule for the new
+ * level may be created from the schedule for the old one (see
+ * RefineAlgorithm::updateSchedule()).  Such a schedule takes the overlaps
+ * of its data transactions between boxes the regrid did not change from
+ * the old schedule instead of computing them again.
+ *
  * @see RefineAlgorithm
  * @see RefinePatchStrategy
  * @see RefineClasses
@@ -108,6 +119,20 @@ public:
     *                                    use time interpolation when setting
     *                                    data on the destination level.
     *                                    Default is no time interpolation.
+    * @param[in] old_schedule  Optional schedule for a destination level that
+    *                          dst_level replaces.  Overlaps of old_schedule
+    *                          between boxes that did not change are reused.
+    *                          This schedule then keeps its own overlaps for
+    *                          later updates.
+    * @param[in] old_to_new  Mapping from the destination BoxLevel of
+    *                        old_schedule to that of dst_level.  If null,
+    *                        an overlap of old_schedule is reused only if
+    *                        its boxes are the same as those of the new
+    *                        transaction.
+    * @param[in] keep_transaction_overlaps  Whether to keep the overlaps
+    *                                       of the transactions for a
+    *                                       schedule that replaces this
+    *                                       one, even without old_schedule.
     *
     * @pre dst_level
     * @pre src_level
@@ -123,7 +148,10 @@ public:
       const std::shared_ptr<RefineClasses>& refine_classes,
       const std::shared_ptr<RefineTransactionFactory>& transaction_factory,
       RefinePatchStrategy* patch_strategy,
-      bool use_time_interpolation = false);
+      bool use_time_interpolation = false,
+      const RefineSchedule* old_schedule = 0,
+      const hier::MappingConnector* old_to_new = 0,
+      bool keep_transaction_overlaps = false);
 
    /*!
     * @brief Constructor that creates a refine schedule to fill destination
@@ -180,6 +208,13 @@ public:
     *                                 time interpolation when setting data
     *                                 on the destination level.  Default
     *                                 is no time interpolation.
+    * @param[in] old_schedule  Optional schedule for a destination level that
+    *                          dst_level replaces.  See the other
+    *                          constructor.
+    * @param[in] old_to_new  Mapping from the destination BoxLevel of
+    *                        old_schedule to that of dst_level.  See the
+    *                        other constructor.
+    * @param[in] keep_transaction_overlaps  See the other constructor.
     *
     * @pre dst_level
     * @pre (next_coarser_level == -1) || hierarchy
@@ -197,7 +232,10 @@ public:
       const std::shared_ptr<RefineClasses>& refine_classes,
       const std::shared_ptr<RefineTransactionFactory>& transaction_factory,
       RefinePatchStrategy* patch_strategy,
-      bool use_time_refinement = false);
+      bool use_time_refinement = false,
+      const RefineSchedule* old_schedule = 0,
+      const hier::MappingConnector* old_to_new = 0,
+      bool keep_transaction_overlaps = false);
 
    /*!
     * Destructor for the schedule releases all internal storage.
@@ -260,6 +298,25 @@ public:
       return d_refine_classes;
    }
 
+   /*!
+    * @brief Return the number of destination and source box pairs for
+    * which this schedule keeps transaction overlaps, counting those of
+    * the internal schedules that fill coarse interpolation levels.
+    *
+    * Overlaps are kept if the schedule was created with
+    * keep_transaction_overlaps or from an old schedule.
+    */
+   size_t
+   getNumberOfKeptTransactionOverlaps() const;
+
+   /*!
+    * @brief Return how many of the pairs counted by
+    * getNumberOfKeptTransactionOverlaps() had their overlaps taken from
+    * an old schedule instead of computing them.
+    */
+   size_t
+   getNumberOfReusedTransactionOverlaps() const;
+
    /*!
     * @brief Set whether to unpack messages in a deterministic order.
     *
@@ -313,6 +370,30 @@ public:
     */
    void deallocateInternalData();
 
+   /*!
+    * @brief Add the memory used by the schedule's transactions, message
+    * buffers and internal metadata to a MetadataMemoryStatistics.
+    *
+    * Internal levels and Connectors are included, as are the recursive
+    * schedules for filling from coarser levels.  The destination and
+    * source levels are not.
+    *
+    * @param[in,out] stats
+    */
+   void
+   computeMemoryFootprint(
+      hier::MetadataMemoryStatistics& stats) const;
+
+   /*!
+    * @brief Return the number of communication cycles of the schedule,
+    * including those of the recursive schedules for filling from coarser
+    * levels, that unpacked messages between sends.
+    *
+    * @see tbox::Schedule::setPipelinedCommunicationFlag()
+    */
+   int
+   getNumberOfPipelinedCommunications() const;
+
    /*!
     * @brief Print the refine schedule data to the specified data stream.
     *
@@ -323,6 +404,18 @@ public:
       std::ostream& stream) const;
 
 private:
+   /*
+    * RefineScheduleGroup executes the steps of fillData() for several
+    * schedules in lock step, combining their communication.
+    */
+   friend class RefineScheduleGroup;
+
+   /*
+    * RefineAlgorithm::updateSchedule() creates a schedule with the
+    * configuration of an existing one.
+    */
+   friend class RefineAlgorithm;
+
    /*
     * Static integer constant describing the largest possible ghost cell width.
     */
@@ -386,6 +479,10 @@ private:
     *                            may be null, in which case no boundary filling
     *                            or user-defined refine operations will occur.
     * @param[in] top_refine_schedule
+    * @param[in] old_schedule  Schedule that filled the coarse interpolation
+    *                          level of the schedule that the parent of this
+    *                          schedule replaces, or null.  Its overlaps are
+    *                          reused where the boxes are spatially unchanged.
     *
     * @pre dst_level
     * @pre src_level
@@ -408,7 +505,8 @@ private:
       const std::shared_ptr<RefineClasses>& refine_classes,
       const std::shared_ptr<RefineTransactionFactory>& transaction_factory,
       RefinePatchStrategy* patch_strategy,
-      const RefineSchedule* top_refine_schedule);
+      const RefineSchedule* top_refine_schedule,
+      const RefineSchedule* old_schedule);
 
    /*!
     * @brief Read static data from input database.
@@ -495,6 +593,55 @@ private:
       const std::shared_ptr<hier::PatchLevel>& level,
       double fill_time) const;
 
+   /*!
+    * @brief Patch data components allocated on the destination level
+    * for the duration of a fill.
+    */
+   struct FillSpace {
+      hier::ComponentSelector d_allocate_vector;
+      hier::ComponentSelector d_encon_allocate_vector;
+      hier::ComponentSelector d_nbr_fill_scratch_vector;
+      hier::ComponentSelector d_nbr_fill_dst_vector;
+   };
+
+   /*!
+    * @brief Patch data components allocated on a coarse interpolation
+    * level while it is filled and interpolated from.
+    */
+   struct CoarseInterpSpace {
+      hier::ComponentSelector d_allocate_vector;
+      hier::ComponentSelector d_work_allocate_vector;
+      hier::ComponentSelector d_encon_allocate_vector;
+      hier::ComponentSelector d_encon_work_allocate_vector;
+      hier::ComponentSelector d_nbr_blk_fill_allocate_vector;
+      hier::ComponentSelector d_nbr_blk_fill_work_allocate_vector;
+      hier::ComponentSelector d_nbr_blk_fill_scratch_vector;
+      hier::ComponentSelector d_nbr_blk_fill_work_vector;
+      hier::ComponentSelector d_nbr_blk_fill_dst_vector;
+   };
+
+   /*!
+    * @brief Set the fill time and allocate the scratch space on the
+    * destination level before the recursive fill.
+    *
+    * @param[in]  fill_time  Simulation time when the fill takes place
+    * @param[out] fill_space Components allocated, for endFill()
+    */
+   void
+   beginFill(
+      double fill_time,
+      FillSpace& fill_space) const;
+
+   /*!
+    * @brief Copy the scratch space to the destination space and
+    * deallocate the space allocated by beginFill().
+    *
+    * @param[in,out] fill_space
+    */
+   void
+   endFill(
+      FillSpace& fill_space) const;
+
    /*!
     * @brief Recursively fill the destination level with data at the
     * given time.
@@ -513,6 +660,73 @@ private:
       double fill_time,
       bool do_physical_boundary_fill) const;
 
+   /*!
+    * @brief Allocate the space needed to fill d_coarse_interp_level.
+    *
+    * @param[in]  fill_time  Simulation time when the fill takes place
+    * @param[out] interp_space  Components allocated, for
+    *                           refineFromCoarseInterp()
+    *
+    * @pre d_coarse_interp_schedule
+    */
+   void
+   allocateCoarseInterpSpace(
+      double fill_time,
+      CoarseInterpSpace& interp_space) const;
+
+   /*!
+    * @brief Interpolate the filled d_coarse_interp_level into the
+    * destination level and deallocate the space allocated by
+    * allocateCoarseInterpSpace().
+    *
+    * @param[in,out] interp_space
+    *
+    * @pre d_coarse_interp_schedule
+    */
+   void
+   refineFromCoarseInterp(
+      CoarseInterpSpace& interp_space) const;
+
+   /*!
+    * @brief Allocate the space needed to fill
+    * d_coarse_interp_encon_level.
+    *
+    * @param[in]  fill_time  Simulation time when the fill takes place
+    * @param[out] interp_space  Components allocated, for
+    *                           refineFromCoarseInterpEncon()
+    *
+    * @pre d_coarse_interp_encon_schedule
+    */
+   void
+   allocateCoarseInterpEnconSpace(
+      double fill_time,
+      CoarseInterpSpace& interp_space) const;
+
+   /*!
+    * @brief Interpolate the filled d_coarse_interp_encon_level into
+    * the enhanced connectivity level and deallocate the space allocated
+    * by allocateCoarseInterpEnconSpace().
+    *
+    * @param[in,out] interp_space
+    *
+    * @pre d_coarse_interp_encon_schedule
+    */
+   void
+   refineFromCoarseInterpEncon(
+      CoarseInterpSpace& interp_space) const;
+
+   /*!
+    * @brief Fill the physical and singularity boundaries of the
+    * destination level, as the last step of recursiveFill().
+    *
+    * @param[in]  fill_time  Simulation time when the fill takes place
+    * @param[in]  do_physical_boundary_fill  See recursiveFill().
+    */
+   void
+   fillBoundaries(
+      double fill_time,
+      bool do_physical_boundary_fill) const;
+
    /*!
     * @brief Fill the physical boundaries for each patch on d_dst_level.
     *
@@ -916,6 +1130,85 @@ private:
       const hier::Box& src_box,
       const bool use_time_interpolation);
 
+   /*!
+    * @brief Overlaps computed by constructScheduleTransactions() for one
+    * pair of destination and source boxes, with the boxes they were
+    * computed from.
+    *
+    * d_overlaps and d_src_masks hold the values for fill box i of
+    * equivalence class nc at index nc * d_fill_boxes.size() + i.
+    */
+   struct TransactionOverlaps {
+      TransactionOverlaps(
+         const tbox::Dimension& dim):
+         d_dst_box(dim),
+         d_src_box(dim)
+      {
+      }
+      hier::Box d_dst_box;
+      hier::Box d_src_box;
+      std::vector<hier::Box> d_fill_boxes;
+      std::vector<std::shared_ptr<hier::BoxOverlap> > d_overlaps;
+      std::vector<hier::Box> d_src_masks;
+   };
+
+   typedef std::map<std::pair<hier::BoxId, hier::BoxId>,
+                    TransactionOverlaps> TransactionOverlapMap;
+
+   /*!
+    * @brief Set up the reuse of the overlaps of an old schedule during
+    * construction, if its overlaps are valid for this schedule.
+    *
+    * Overlaps are reused only if old_schedule kept them and uses the
+    * same RefineClasses object and the same destination level number and
+    * refinement ratio as this schedule.  old_to_new may be null, as for
+    * the internal coarse interpolation levels, which have no mapping;
+    * overlaps are then checked by comparing boxes only.
+    */
+   void
+   setOldSchedule(
+      const RefineSchedule* old_schedule,
+      const hier::MappingConnector* old_to_new);
+
+   /*!
+    * @brief Return the RefineClasses for a schedule filling a coarse
+    * interpolation level of this schedule.
+    *
+    * The classes of old_coarse_schedule, which filled the corresponding
+    * level for the schedule this one replaces, are returned if they were
+    * built from the same RefineClasses object.  Otherwise new classes are
+    * built.
+    */
+   std::shared_ptr<RefineClasses>
+   getCoarseScheduleRefineClasses(
+      const RefineSchedule* old_coarse_schedule) const;
+
+   /*!
+    * @brief Return the overlaps of old schedule for the given boxes and
+    * fill boxes, or null if they cannot be reused.
+    *
+    * The overlaps can be reused if the old schedule has overlaps for the
+    * same BoxIds and the destination box, source box and fill boxes are
+    * spatially unchanged.  Old local boxes that changed according to the
+    * old-to-new mapping are not looked up.
+    */
+   const TransactionOverlaps *
+   findOldOverlaps(
+      const hier::Box& dst_box,
+      const hier::Box& src_box,
+      int num_nbrs,
+      const hier::BoxNeighborhoodCollection::ConstNeighborIterator& nbrs_begin,
+      const hier::BoxNeighborhoodCollection::ConstNeighborIterator& nbrs_end)
+   const;
+
+   /*!
+    * @brief Whether a local box of the old destination level was changed
+    * according to the old-to-new mapping.
+    */
+   bool
+   isChangedByMapping(
+      const hier::Box& box) const;
+
    /*!
     * @brief Reorder the neighborhood sets from a src_to_dst Connector
     * so they can be used in schedule generation.
@@ -1281,6 +1574,53 @@ private:
     */
    int d_max_fill_boxes;
 
+   /*!
+    * @brief Whether this schedule keeps the overlaps of its transactions
+    * in d_transaction_overlaps.
+    */
+   bool d_keep_transaction_overlaps;
+
+   /*!
+    * @brief Overlaps of the transactions of this schedule, for reuse by
+    * a schedule that replaces it.
+    */
+   TransactionOverlapMap d_transaction_overlaps;
+
+   /*!
+    * @brief Number of entries of d_transaction_overlaps that were taken
+    * from d_old_schedule instead of being computed.
+    */
+   size_t d_num_reused_transaction_overlaps;
+
+   /*!
+    * @brief Schedule whose overlaps are reused, and the mapping from its
+    * destination level to the destination level of this schedule.  Set
+    * only during construction.
+    */
+   const RefineSchedule* d_old_schedule;
+   const hier::MappingConnector* d_old_to_new;
+
+   //@}
+
+   /*!
+    * @name Configuration this schedule was created with, used by
+    * RefineAlgorithm::updateSchedule()
+    */
+
+   //@{
+
+   /*!
+    * @brief Whether this schedule fills from coarser hierarchy levels,
+    * i.e., was created with the constructor taking the hierarchy.
+    */
+   bool d_fill_from_coarser;
+
+   int d_next_coarser_ln;
+
+   std::shared_ptr<hier::PatchHierarchy> d_hierarchy;
+
+   bool d_use_time_refinement;
+
    //@}
 
    /*!
@@ -0,0 +1,189 @@
+/*************************************************************************
+ *
+ * This file is part of the SAMRAI distribution.  For full copyright
+ * information, see COPYRIGHT and LICENSE.
+ *
+ * Copyright:     (c) 1997-2020 Lawrence Livermore National Security, LLC
+ * Description:   Group of refine schedules filled with combined messages
+ *
+ ************************************************************************/
+
+#ifndef included_xfer_RefineScheduleGroup
+#define included_xfer_RefineScheduleGroup
+
+#include "SAMRAI/SAMRAI_config.h"
+
+#include "SAMRAI/xfer/RefineSchedule.h"
+#include "SAMRAI/tbox/ScheduleGroup.h"
+
+#include <memory>
+#include <vector>
+
+namespace SAMRAI {
+namespace xfer {
+
+/*!
+ * @brief Class RefineScheduleGroup fills the data of several
+ * RefineSchedules at once, sending one message per peer for all of them.
+ *
+ * Calling fillData() on several schedules one after the other, for
+ * example one schedule per set of variables on the same level, sends a
+ * round of messages for each schedule.  RefineScheduleGroup::fillData()
+ * performs the same steps as RefineSchedule::fillData() on all member
+ * schedules in lock step.  Each communication step of the members,
+ * including those of the recursive fills from coarser levels, is
+ * executed through a tbox::ScheduleGroup, so each peer gets a single
+ * message per step instead of one per member schedule.
+ *
+ * Member schedules must be independent of each other: no member may
+ * write a patch data component that another member reads or writes on
+ * the same level.  addSchedule() checks this for the destination and
+ * source levels of the members.  All processes must add the
+ * corresponding schedules in the same order.
+ *
+ * The group may be filled any number of times.  It is updated
+ * automatically when a member schedule is reset.
+ *
+ * @see RefineSchedule
+ * @see tbox::ScheduleGroup
+ */
+
+class RefineScheduleGroup
+{
+public:
+   /*!
+    * @brief Create an empty group.
+    */
+   RefineScheduleGroup();
+
+   /*!
+    * @brief The destructor releases the combined communication
+    * schedules but not the member schedules.
+    */
+   ~RefineScheduleGroup();
+
+   /*!
+    * @brief Add a schedule to the group.
+    *
+    * An unrecoverable error occurs if the schedule writes data that
+    * another member reads or writes.
+    *
+    * @param[in] schedule
+    *
+    * @pre schedule
+    */
+   void
+   addSchedule(
+      const std::shared_ptr<RefineSchedule>& schedule);
+
+   /*!
+    * @brief Remove all schedules from the group.
+    */
+   void
+   clear();
+
+   /*!
+    * @brief Return the number of schedules in the group.
+    */
+   int
+   getNumberOfSchedules() const
+   {
+      return static_cast<int>(d_schedules.size());
+   }
+
+   /*!
+    * @brief Execute all member schedules.
+    *
+    * The result is the same as calling RefineSchedule::fillData() with
+    * the same arguments on each member.
+    *
+    * @param[in] fill_time  Time for filling operation.
+    * @param[in] do_physical_boundary_fill  See RefineSchedule::fillData().
+    */
+   void
+   fillData(
+      double fill_time,
+      bool do_physical_boundary_fill = true);
+
+   /*!
+    * @brief Set whether to unpack messages in a deterministic order.
+    *
+    * @see RefineSchedule::setDeterministicUnpackOrderingFlag()
+    *
+    * @param [in] flag
+    */
+   void
+   setDeterministicUnpackOrderingFlag(
+      bool flag);
+
+private:
+   // Unimplemented copy constructor.
+   RefineScheduleGroup(
+      const RefineScheduleGroup&);
+
+   // Unimplemented assignment operator.
+   RefineScheduleGroup&
+   operator = (
+      const RefineScheduleGroup&);
+
+   /*!
+    * @brief The schedules at one depth of the recursive fill and the
+    * combined communication of their level schedules.
+    */
+   struct Stage {
+      std::vector<const RefineSchedule *> d_schedules;
+      tbox::ScheduleGroup d_coarse_priority_group;
+      tbox::ScheduleGroup d_fine_priority_group;
+   };
+
+   /*!
+    * @brief Build the stages of the recursive fill, reusing the
+    * existing ones if the members and their level schedules have not
+    * changed.
+    */
+   void
+   setUpStages();
+
+   /*!
+    * @brief Fill the destination levels of the schedules in the given
+    * stage and, recursively, the coarse interpolation levels they
+    * depend on.
+    *
+    * @see RefineSchedule::recursiveFill()
+    */
+   void
+   recursiveFill(
+      size_t stage_number,
+      double fill_time,
+      bool do_physical_boundary_fill);
+
+   /*!
+    * @brief Report an error if one schedule writes data that the other
+    * reads or writes.
+    */
+   static void
+   checkIndependence(
+      const RefineSchedule& a,
+      const RefineSchedule& b);
+
+   /*!
+    * @brief The member schedules, in the order they were added.
+    */
+   std::vector<std::shared_ptr<RefineSchedule> > d_schedules;
+
+   /*!
+    * @brief Stages of the recursive fill.  Stage 0 holds the members,
+    * stage n+1 holds the coarse interpolation schedules of stage n.
+    */
+   std::vector<std::shared_ptr<Stage> > d_stages;
+
+   /*!
+    * @brief Whether to unpack messages in a deterministic order.
+    */
+   bool d_unpack_in_deterministic_order;
+};
+
+}
+}
+
+#endif
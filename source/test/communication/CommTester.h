@@ -39,6 +39,8 @@
 #include "SAMRAI/hier/VariableContext.h"
 
 #include <memory>
+#include <utility>
+#include <vector>
 
 namespace SAMRAI {
 
@@ -76,7 +78,8 @@ public:
       PatchDataTestStrategy* strategy,
       bool do_refine = true,
       bool do_coarsen = false,
-      const std::string& refine_option = "INTERIOR_FROM_SAME_LEVEL");
+      const std::string& refine_option = "INTERIOR_FROM_SAME_LEVEL",
+      bool use_schedule_groups = false);
 
    /**
     * Destructor is empty.
@@ -158,6 +161,18 @@ public:
    performCoarsenOperations(
       const int level_number);
 
+   /**
+    * Refine or coarsen data to all levels through one
+    * xfer::RefineScheduleGroup or xfer::CoarsenScheduleGroup, into a
+    * second set of destination data, and check that it matches the data
+    * filled by the individual schedules.  Must be called after the
+    * individual refine or coarsen operations on all levels.
+    *
+    * @returns Whether the group and individual results match.
+    */
+   bool
+   performGroupOperations();
+
    /**
     * After communication operations are performed, check results.
     *
@@ -166,6 +181,17 @@ public:
    bool
    verifyCommunicationResults() const;
 
+   /**
+    * Return the number of communication cycles of the refine schedules
+    * run by performRefineOperations() that unpacked messages between
+    * sends.
+    */
+   int
+   getNumberOfPipelinedCommunications() const
+   {
+      return d_num_pipelined_communications;
+   }
+
    /**
     * Operations needed by mesh::GriddingAlgorithm to construct and
     * initialize levels in patch hierarchy.  These operations are
@@ -343,6 +369,18 @@ private:
    std::shared_ptr<hier::VariableContext> d_reset_destination;
    std::shared_ptr<hier::VariableContext> d_reset_refine_scratch;
 
+   /*
+    * When testing schedule groups, the groups fill the "group_destination"
+    * data, using "group_refine_scratch" for scratch space, and the result
+    * is compared with the "destination" data filled by the individual
+    * schedules.  Each entry of d_group_data_ids is a pair of destination
+    * and group destination patch data indices.
+    */
+   bool d_use_schedule_groups;
+   std::shared_ptr<hier::VariableContext> d_group_destination;
+   std::shared_ptr<hier::VariableContext> d_group_refine_scratch;
+   std::vector<std::pair<int, int> > d_group_data_ids;
+
    /*
     * Component selector for allocation/deallocation of variable data.
     */
@@ -359,9 +397,13 @@ private:
 
    xfer::RefineAlgorithm d_reset_refine_algorithm;
    xfer::CoarsenAlgorithm d_reset_coarsen_algorithm;
+   xfer::RefineAlgorithm d_group_refine_algorithm;
+   xfer::CoarsenAlgorithm d_group_coarsen_algorithm;
 
    bool d_is_reset;
 
+   int d_num_pipelined_communications;
+
    std::vector<std::shared_ptr<xfer::RefineSchedule> > d_fill_source_schedule;
    std::vector<std::shared_ptr<xfer::RefineSchedule> > d_refine_schedule;
    std::vector<std::shared_ptr<xfer::CoarsenSchedule> > d_coarsen_schedule;
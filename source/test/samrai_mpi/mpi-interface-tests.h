@@ -44,6 +44,17 @@ int
 mpiInterfaceTestAllreduce(
    int& fail_count);
 
+/*!
+ * @brief Test tbox::ReductionBatch.
+ *
+ * @param fail_count Increment this count by number of failures.
+ *
+ * @return number of failures found.
+ */
+int
+mpiInterfaceTestReductionBatch(
+   int& fail_count);
+
 /*!
  * @brief Test SAMRAI_MPI::parallelPrefixSum.
  *